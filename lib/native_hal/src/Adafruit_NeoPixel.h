@@ -0,0 +1,43 @@
+#ifndef NATIVE_ADAFRUIT_NEOPIXEL_H
+#define NATIVE_ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+#include <vector>
+
+#define NEO_GRB     ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_RGB     ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_KHZ800  0x0000
+
+typedef uint16_t neoPixelType;
+
+// Keeps pixel colours in memory so host code can inspect the LED state
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800)
+      : _pixels(n, 0), _brightness(255) {
+    (void)pin;
+    (void)type;
+  }
+  void begin() {}
+  void show() {}
+  void clear() { std::fill(_pixels.begin(), _pixels.end(), 0); }
+  void setBrightness(uint8_t b) { _brightness = b; }
+  uint8_t getBrightness() const { return _brightness; }
+  uint16_t numPixels() const { return (uint16_t)_pixels.size(); }
+  void setPixelColor(uint16_t n, uint32_t c) {
+    if (n < _pixels.size()) _pixels[n] = c;
+  }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    setPixelColor(n, Color(r, g, b));
+  }
+  uint32_t getPixelColor(uint16_t n) const { return n < _pixels.size() ? _pixels[n] : 0; }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+private:
+  std::vector<uint32_t> _pixels;
+  uint8_t _brightness;
+};
+
+#endif
@@ -0,0 +1,346 @@
+#include "Arduino.h"
+#include "NativeHost.h"
+#include <ctype.h>
+#include <stdarg.h>
+#include <atomic>
+#include <map>
+#include <new>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// ==================== Simulated Clock ====================
+static unsigned long simMillis = 0;
+static unsigned long simMicrosFrac = 0;
+static time_t simEpoch = 1760486400;  // 2025-10-15 00:00:00 UTC
+
+void nativeAdvanceMillis(unsigned long ms) {
+  simMillis += ms;
+}
+
+void nativeSetEpoch(time_t epoch) {
+  simEpoch = epoch;
+}
+
+time_t nativeEpoch() {
+  return simEpoch;
+}
+
+unsigned long millis() {
+  return simMillis;
+}
+
+unsigned long micros() {
+  return simMillis * 1000UL + simMicrosFrac;
+}
+
+void delay(unsigned long ms) {
+  simMillis += ms;
+}
+
+void delayMicroseconds(unsigned int us) {
+  simMicrosFrac += us;
+  simMillis += simMicrosFrac / 1000;
+  simMicrosFrac %= 1000;
+}
+
+void yield() {}
+
+// Interpose libc time() so firmware code that calls time(nullptr) sees the
+// simulated wall clock rather than the host's.
+extern "C" time_t time(time_t* out) noexcept {
+  time_t now = simEpoch + (time_t)(simMillis / 1000);
+  if (out) *out = now;
+  return now;
+}
+
+// ==================== GPIO / PWM ====================
+static std::map<uint8_t, int> pinLevels;
+
+void nativeSetPin(uint8_t pin, int level) {
+  pinLevels[pin] = level;
+}
+
+int nativeGetPin(uint8_t pin) {
+  auto it = pinLevels.find(pin);
+  return it == pinLevels.end() ? HIGH : it->second;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  pinLevels[pin] = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+  return nativeGetPin(pin);
+}
+
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolutionBits) {
+  (void)channel;
+  (void)resolutionBits;
+  return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel) {
+  (void)pin;
+  (void)channel;
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty) {
+  (void)channel;
+  (void)duty;
+}
+
+// ==================== NTP ====================
+void configTime(long gmtOffset_sec, int daylightOffset_sec,
+                const char* server1, const char* server2, const char* server3) {
+  (void)daylightOffset_sec;
+  (void)server1;
+  (void)server2;
+  (void)server3;
+
+  // Same POSIX TZ string the ESP32 core builds: sign is inverted
+  long offset = -gmtOffset_sec;
+  char tz[32];
+  snprintf(tz, sizeof(tz), "UTC%c%ld:%02ld", offset < 0 ? '-' : '+',
+           labs(offset) / 3600, (labs(offset) % 3600) / 60);
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+// ==================== String ====================
+static std::string formatFloat(double v, unsigned int decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+  return buf;
+}
+
+String::String(float v, unsigned int decimals) : _s(formatFloat(v, decimals)) {}
+String::String(double v, unsigned int decimals) : _s(formatFloat(v, decimals)) {}
+
+bool String::equalsIgnoreCase(const String& rhs) const {
+  if (_s.length() != rhs._s.length()) return false;
+  for (size_t i = 0; i < _s.length(); i++) {
+    if (tolower((unsigned char)_s[i]) != tolower((unsigned char)rhs._s[i])) return false;
+  }
+  return true;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+  size_t pos = _s.find(c, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& s, unsigned int from) const {
+  size_t pos = _s.find(s._s, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const {
+  size_t pos = _s.rfind(c);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(const String& s) const {
+  size_t pos = _s.rfind(s._s);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+bool String::startsWith(const String& prefix) const {
+  return _s.compare(0, prefix._s.length(), prefix._s) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+  if (suffix._s.length() > _s.length()) return false;
+  return _s.compare(_s.length() - suffix._s.length(), suffix._s.length(), suffix._s) == 0;
+}
+
+String String::substring(unsigned int from) const {
+  if (from >= _s.length()) return String();
+  return String(_s.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= _s.length()) return String();
+  if (to > _s.length()) to = (unsigned int)_s.length();
+  return String(_s.substr(from, to - from));
+}
+
+void String::replace(const String& find, const String& with) {
+  if (find._s.empty()) return;
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+    _s.replace(pos, find._s.length(), with._s);
+    pos += with._s.length();
+  }
+}
+
+void String::replace(char find, char with) {
+  std::replace(_s.begin(), _s.end(), find, with);
+}
+
+void String::remove(unsigned int index) {
+  if (index < _s.length()) _s.erase(index);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index < _s.length()) _s.erase(index, count);
+}
+
+void String::trim() {
+  size_t start = 0;
+  while (start < _s.length() && isspace((unsigned char)_s[start])) start++;
+  size_t end = _s.length();
+  while (end > start && isspace((unsigned char)_s[end - 1])) end--;
+  _s = _s.substr(start, end - start);
+}
+
+void String::toLowerCase() {
+  for (auto& c : _s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (auto& c : _s) c = (char)toupper((unsigned char)c);
+}
+
+String operator+(const String& lhs, const String& rhs) {
+  String out(lhs);
+  out += rhs;
+  return out;
+}
+
+String operator+(const String& lhs, const char* rhs) {
+  String out(lhs);
+  out += rhs;
+  return out;
+}
+
+String operator+(const char* lhs, const String& rhs) {
+  String out(lhs);
+  out += rhs;
+  return out;
+}
+
+String operator+(const String& lhs, char rhs) {
+  String out(lhs);
+  out += rhs;
+  return out;
+}
+
+// ==================== Serial ====================
+size_t HardwareSerial::print(const char* s) {
+  return fputs(s ? s : "", stdout) < 0 ? 0 : strlen(s ? s : "");
+}
+
+size_t HardwareSerial::print(char c) {
+  return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::print(int v) {
+  return (size_t)::printf("%d", v);
+}
+
+size_t HardwareSerial::print(unsigned int v) {
+  return (size_t)::printf("%u", v);
+}
+
+size_t HardwareSerial::print(long v) {
+  return (size_t)::printf("%ld", v);
+}
+
+size_t HardwareSerial::print(unsigned long v) {
+  return (size_t)::printf("%lu", v);
+}
+
+size_t HardwareSerial::print(double v, int decimals) {
+  return (size_t)::printf("%.*f", decimals, v);
+}
+
+size_t HardwareSerial::println() {
+  return print("\r\n");
+}
+
+size_t HardwareSerial::printf(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vprintf(fmt, args);
+  va_end(args);
+  return n < 0 ? 0 : (size_t)n;
+}
+
+// ==================== ESP ====================
+// Heap figures are modelled on a WROOM-32 without PSRAM: a fixed-size heap
+// from which the host allocator's in-use bytes are subtracted.
+static const uint32_t SIM_HEAP_SIZE = 320 * 1024;
+static uint32_t minFreeHeap = SIM_HEAP_SIZE;
+
+static uint32_t hostBytesInUse() {
+#if defined(__GLIBC__)
+  struct mallinfo2 mi = mallinfo2();
+  return (uint32_t)mi.uordblks;
+#else
+  return 0;
+#endif
+}
+
+void EspClass::restart() {
+  Serial.println("ESP.restart() requested - exiting");
+  fflush(stdout);
+  exit(0);
+}
+
+uint32_t EspClass::getHeapSize() {
+  return SIM_HEAP_SIZE;
+}
+
+uint32_t EspClass::getFreeHeap() {
+  uint32_t used = hostBytesInUse();
+  uint32_t freeHeap = used >= SIM_HEAP_SIZE ? 0 : SIM_HEAP_SIZE - used;
+  if (freeHeap < minFreeHeap) minFreeHeap = freeHeap;
+  return freeHeap;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+  getFreeHeap();
+  return minFreeHeap;
+}
+
+// Replacing the global allocation functions counts every C++ allocation;
+// the sized/aligned forms fall back to these two
+static std::atomic<uint32_t> allocCount(0);
+
+void* operator new(size_t size) {
+  allocCount.fetch_add(1, std::memory_order_relaxed);
+  void* p = malloc(size ? size : 1);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+// GCC flags free() in a replacement operator delete as a new/free mismatch
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+#pragma GCC diagnostic pop
+
+uint32_t nativeAllocCount() {
+  return allocCount.load(std::memory_order_relaxed);
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  // The host allocator does not expose its largest free block
+  return getFreeHeap();
+}
@@ -0,0 +1,181 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+/**
+ * Host stand-in for the Arduino-ESP32 core.
+ *
+ * Only the subset used by src/ is provided. Time is simulated: millis()
+ * and time() advance when delay() is called or when the host runner
+ * steps the clock (see NativeHost.h), never on their own.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+#include "pgmspace.h"
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// ==================== Timing ====================
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// ==================== GPIO / PWM ====================
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolutionBits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+// ==================== NTP ====================
+void configTime(long gmtOffset_sec, int daylightOffset_sec,
+                const char* server1, const char* server2 = nullptr,
+                const char* server3 = nullptr);
+
+// ==================== String ====================
+class String {
+public:
+  String() {}
+  String(const char* s) : _s(s ? s : "") {}
+  String(const std::string& s) : _s(s) {}
+  String(char c) : _s(1, c) {}
+  String(int v) : _s(std::to_string(v)) {}
+  String(unsigned int v) : _s(std::to_string(v)) {}
+  String(long v) : _s(std::to_string(v)) {}
+  String(unsigned long v) : _s(std::to_string(v)) {}
+  String(long long v) : _s(std::to_string(v)) {}
+  String(float v, unsigned int decimals = 2);
+  String(double v, unsigned int decimals = 2);
+
+  unsigned int length() const { return (unsigned int)_s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  const char* c_str() const { return _s.c_str(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+  char charAt(unsigned int i) const { return i < _s.length() ? _s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return _s[i]; }
+
+  String& operator=(const char* s) { _s = s ? s : ""; return *this; }
+  String& operator+=(const String& rhs) { _s += rhs._s; return *this; }
+  String& operator+=(const char* rhs) { if (rhs) _s += rhs; return *this; }
+  String& operator+=(char c) { _s += c; return *this; }
+  String& operator+=(int v) { _s += std::to_string(v); return *this; }
+  String& operator+=(unsigned int v) { _s += std::to_string(v); return *this; }
+  String& operator+=(long v) { _s += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v) { _s += std::to_string(v); return *this; }
+  bool concat(const String& rhs) { _s += rhs._s; return true; }
+  bool concat(const char* rhs) { if (rhs) _s += rhs; return true; }
+  bool concat(char c) { _s += c; return true; }
+
+  bool operator==(const String& rhs) const { return _s == rhs._s; }
+  bool operator==(const char* rhs) const { return _s == (rhs ? rhs : ""); }
+  bool operator!=(const String& rhs) const { return !(*this == rhs); }
+  bool operator!=(const char* rhs) const { return !(*this == rhs); }
+  bool operator<(const String& rhs) const { return _s < rhs._s; }
+  bool equals(const String& rhs) const { return _s == rhs._s; }
+  bool equalsIgnoreCase(const String& rhs) const;
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const String& s, unsigned int from = 0) const;
+  int lastIndexOf(char c) const;
+  int lastIndexOf(const String& s) const;
+  bool startsWith(const String& prefix) const;
+  bool endsWith(const String& suffix) const;
+
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+
+  void replace(const String& find, const String& with);
+  void replace(char find, char with);
+  void remove(unsigned int index);
+  void remove(unsigned int index, unsigned int count);
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+
+  long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_s.c_str(), nullptr); }
+  double toDouble() const { return strtod(_s.c_str(), nullptr); }
+
+  const std::string& str() const { return _s; }
+
+private:
+  std::string _s;
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+String operator+(const String& lhs, char rhs);
+
+// ==================== Serial ====================
+class HardwareSerial {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+  size_t print(const char* s);
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(char c);
+  size_t print(int v);
+  size_t print(unsigned int v);
+  size_t print(long v);
+  size_t print(unsigned long v);
+  size_t print(double v, int decimals = 2);
+  size_t println();
+  template <typename T>
+  size_t println(const T& v) { size_t n = print(v); return n + println(); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  int available() { return 0; }
+  int read() { return -1; }
+  void flush() {}
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// ==================== ESP ====================
+class EspClass {
+public:
+  void restart();
+  uint32_t getHeapSize();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getCpuFreqMHz() { return 240; }
+};
+
+extern EspClass ESP;
+
+// Sketch entry points (defined in src/main.cpp)
+void setup();
+void loop();
+
+#endif
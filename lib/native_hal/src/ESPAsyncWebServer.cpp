@@ -0,0 +1,75 @@
+#include "ESPAsyncWebServer.h"
+#include "NativeHost.h"
+
+static AsyncWebServer* activeServer = nullptr;
+
+// ==================== AsyncWebServerRequest ====================
+const AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post,
+                                                         bool file) const {
+  (void)file;
+  for (const auto& p : _params) {
+    if (p.name() == name && p.isPost() == post) return &p;
+  }
+  return nullptr;
+}
+
+bool AsyncWebServerRequest::hasArg(const char* name) const {
+  for (const auto& p : _params) {
+    if (p.name() == name) return true;
+  }
+  return false;
+}
+
+const String& AsyncWebServerRequest::arg(const String& name) const {
+  static const String empty;
+  for (const auto& p : _params) {
+    if (p.name() == name) return p.value();
+  }
+  return empty;
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content) {
+  _code = code;
+  _contentType = contentType;
+  _body = content;
+}
+
+// ==================== AsyncWebServer ====================
+AsyncWebServer::AsyncWebServer(uint16_t port) {
+  (void)port;
+  activeServer = this;
+}
+
+AsyncWebServer::~AsyncWebServer() {
+  if (activeServer == this) activeServer = nullptr;
+}
+
+void AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                        ArRequestHandlerFunction onRequest) {
+  _routes.push_back({String(uri), method, onRequest});
+}
+
+bool AsyncWebServer::dispatch(AsyncWebServerRequest* request) {
+  if (!_started) return false;
+  for (const auto& route : _routes) {
+    if (route.uri == request->url() && (route.method & request->method())) {
+      route.handler(request);
+      return true;
+    }
+  }
+  return false;
+}
+
+// ==================== Host Entry Point ====================
+NativeResponse nativeRequest(const char* path, bool isPost,
+                             const std::map<String, String>& params) {
+  AsyncWebServerRequest request(isPost ? HTTP_POST : HTTP_GET, String(path));
+  for (const auto& kv : params) {
+    request.addParam(kv.first, kv.second, isPost);
+  }
+
+  if (!activeServer || !activeServer->dispatch(&request)) {
+    return {404, String("text/plain"), String("Not found")};
+  }
+  return {request.responseCode(), request.responseType(), request.responseBody()};
+}
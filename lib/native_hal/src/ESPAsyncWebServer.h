@@ -0,0 +1,107 @@
+#ifndef NATIVE_ESPASYNCWEBSERVER_H
+#define NATIVE_ESPASYNCWEBSERVER_H
+
+/**
+ * Synchronous stand-in for ESPAsyncWebServer. Routes are recorded by on()
+ * and invoked in-process by nativeRequest() (see NativeHost.h); there is
+ * no socket and no AsyncTCP task.
+ */
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+typedef enum {
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_DELETE = 0b00000100,
+  HTTP_PUT = 0b00001000,
+  HTTP_PATCH = 0b00010000,
+  HTTP_HEAD = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerRequest;
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+
+class AsyncWebParameter {
+public:
+  AsyncWebParameter(const String& name, const String& value, bool post)
+      : _name(name), _value(value), _isPost(post) {}
+  const String& name() const { return _name; }
+  const String& value() const { return _value; }
+  bool isPost() const { return _isPost; }
+  bool isFile() const { return false; }
+
+private:
+  String _name;
+  String _value;
+  bool _isPost;
+};
+
+class AsyncWebServerRequest {
+public:
+  AsyncWebServerRequest(WebRequestMethodComposite method, const String& url)
+      : _method(method), _url(url) {}
+
+  WebRequestMethodComposite method() const { return _method; }
+  const String& url() const { return _url; }
+
+  void addParam(const String& name, const String& value, bool post) {
+    _params.emplace_back(name, value, post);
+  }
+  size_t params() const { return _params.size(); }
+  const AsyncWebParameter* getParam(size_t num) const {
+    return num < _params.size() ? &_params[num] : nullptr;
+  }
+  bool hasParam(const String& name, bool post = false, bool file = false) const {
+    return getParam(name, post, file) != nullptr;
+  }
+  const AsyncWebParameter* getParam(const String& name, bool post = false,
+                                    bool file = false) const;
+  bool hasArg(const char* name) const;
+  const String& arg(const String& name) const;
+
+  void send(int code, const String& contentType = String(), const String& content = String());
+  void send_P(int code, const String& contentType, PGM_P content) { send(code, contentType, content); }
+
+  // Host-only: what the handler replied
+  int responseCode() const { return _code; }
+  const String& responseType() const { return _contentType; }
+  const String& responseBody() const { return _body; }
+
+private:
+  WebRequestMethodComposite _method;
+  String _url;
+  std::vector<AsyncWebParameter> _params;
+  int _code = 0;
+  String _contentType;
+  String _body;
+};
+
+class AsyncWebServer {
+public:
+  explicit AsyncWebServer(uint16_t port);
+  ~AsyncWebServer();
+
+  void on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+  void begin() { _started = true; }
+  void end() { _started = false; }
+
+  // Host-only: run the matching handler; returns false (404) if none matched
+  bool dispatch(AsyncWebServerRequest* request);
+
+private:
+  struct Route {
+    String uri;
+    WebRequestMethodComposite method;
+    ArRequestHandlerFunction handler;
+  };
+  std::vector<Route> _routes;
+  bool _started = false;
+};
+
+#endif
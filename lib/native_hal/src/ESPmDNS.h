@@ -0,0 +1,19 @@
+#ifndef NATIVE_ESPMDNS_H
+#define NATIVE_ESPMDNS_H
+
+#include <Arduino.h>
+
+class MDNSResponder {
+public:
+  bool begin(const char* hostName) { return hostName != nullptr; }
+  void end() {}
+  void addService(const char* service, const char* proto, uint16_t port) {
+    (void)service;
+    (void)proto;
+    (void)port;
+  }
+};
+
+extern MDNSResponder MDNS;
+
+#endif
@@ -0,0 +1,79 @@
+#include "LittleFS.h"
+#include <map>
+#include <string>
+
+static const size_t NATIVE_FS_BYTES = 1408 * 1024;  // esp32dev default spiffs partition
+
+static std::map<std::string, std::shared_ptr<std::vector<uint8_t>>>& files() {
+  static std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> store;
+  return store;
+}
+
+LittleFSFS LittleFS;
+
+// ==================== File ====================
+size_t File::write(const uint8_t* buf, size_t len) {
+  if (!_data || !_writable) return 0;
+  _data->insert(_data->end(), buf, buf + len);
+  return len;
+}
+
+size_t File::read(uint8_t* buf, size_t len) {
+  if (!_data) return 0;
+  size_t n = std::min(len, _data->size() - _pos);
+  memcpy(buf, _data->data() + _pos, n);
+  _pos += n;
+  return n;
+}
+
+// ==================== LittleFS ====================
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles,
+                       const char* partitionLabel) {
+  (void)formatOnFail; (void)basePath; (void)maxOpenFiles; (void)partitionLabel;
+  return true;
+}
+
+File LittleFSFS::open(const char* path, const char* mode) {
+  if (!path || !mode) return File();
+  if (mode[0] == 'w') {
+    auto data = std::make_shared<std::vector<uint8_t>>();
+    files()[path] = data;
+    return File(data, true);
+  }
+  auto it = files().find(path);
+  if (it == files().end()) return File();
+  return File(it->second, false);
+}
+
+bool LittleFSFS::exists(const char* path) {
+  return path && files().count(path) > 0;
+}
+
+bool LittleFSFS::remove(const char* path) {
+  return path && files().erase(path) > 0;
+}
+
+bool LittleFSFS::rename(const char* pathFrom, const char* pathTo) {
+  if (!pathFrom || !pathTo) return false;
+  auto it = files().find(pathFrom);
+  if (it == files().end()) return false;
+  auto data = it->second;
+  files().erase(it);
+  files()[pathTo] = data;
+  return true;
+}
+
+bool LittleFSFS::mkdir(const char* path) {
+  (void)path;
+  return true;
+}
+
+size_t LittleFSFS::totalBytes() {
+  return NATIVE_FS_BYTES;
+}
+
+size_t LittleFSFS::usedBytes() {
+  size_t used = 0;
+  for (auto& f : files()) used += f.second->size();
+  return used;
+}
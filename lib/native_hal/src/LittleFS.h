@@ -0,0 +1,47 @@
+#ifndef NATIVE_LITTLEFS_H
+#define NATIVE_LITTLEFS_H
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+/**
+ * In-memory LittleFS stand-in. Files persist for the lifetime of the
+ * process; directories are implied by paths, so mkdir() always succeeds.
+ * Only the calls the firmware uses are modelled.
+ */
+class File {
+public:
+  File() {}
+  File(std::shared_ptr<std::vector<uint8_t>> data, bool writable)
+      : _data(data), _writable(writable) {}
+
+  size_t write(const uint8_t* buf, size_t len);
+  size_t read(uint8_t* buf, size_t len);
+  size_t size() const { return _data ? _data->size() : 0; }
+  void close() { _data.reset(); }
+  operator bool() const { return (bool)_data; }
+
+private:
+  std::shared_ptr<std::vector<uint8_t>> _data;
+  size_t _pos = 0;
+  bool _writable = false;
+};
+
+class LittleFSFS {
+public:
+  bool begin(bool formatOnFail = false, const char* basePath = "/littlefs",
+             uint8_t maxOpenFiles = 10, const char* partitionLabel = "spiffs");
+  // "r" opens an existing file, "w" creates or truncates one
+  File open(const char* path, const char* mode = "r");
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool rename(const char* pathFrom, const char* pathTo);
+  bool mkdir(const char* path);
+  size_t totalBytes();
+  size_t usedBytes();
+};
+
+extern LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef NATIVE_HOST_H
+#define NATIVE_HOST_H
+
+/**
+ * Controls for driving the firmware on the host (env:native).
+ *
+ * Nothing in src/ includes this header; it is used by the native runner
+ * in main_native.cpp and by host-side benchmarks.
+ */
+
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+// ==================== Simulated Clock ====================
+// millis() starts at 0; time() is nativeEpoch() + millis() / 1000
+void nativeAdvanceMillis(unsigned long ms);
+void nativeSetEpoch(time_t epoch);
+time_t nativeEpoch();
+
+// ==================== Heap ====================
+// operator new calls since start (String, std containers, new). Buffers from
+// malloc/calloc are not counted; they show up in ESP.getFreeHeap() instead.
+uint32_t nativeAllocCount();
+
+// ==================== GPIO ====================
+// Inputs read HIGH (pull-up idle) until overridden
+void nativeSetPin(uint8_t pin, int level);
+int nativeGetPin(uint8_t pin);
+
+// ==================== HTTP ====================
+struct NativeResponse {
+  int code;
+  String contentType;
+  String body;
+};
+
+// Dispatch a request to the handler registered with server.on().
+// Params are sent as POST body params when isPost is true, query params otherwise.
+NativeResponse nativeRequest(const char* path, bool isPost,
+                             const std::map<String, String>& params);
+
+// ==================== Display ====================
+// Raw 320x240 RGB565 framebuffer of the global TFT (row-major, native colour order)
+const uint16_t* nativeFramebuffer();
+int nativeFramebufferWidth();
+int nativeFramebufferHeight();
+
+// Write the framebuffer as a binary PPM (P6); returns false on I/O error
+bool nativeWritePpm(const char* path);
+
+// ==================== Display DMA ====================
+struct NativeDmaStats {
+  uint32_t queued;            // pushImageDMA() transfers started
+  uint32_t completed;         // Transfers written to the framebuffer
+  uint32_t pixels;            // Pixels queued
+  uint32_t reuseViolations;   // Source buffer changed while its transfer was in flight
+  uint32_t accessViolations;  // TFT drawn or read while a transfer was in flight
+};
+
+const NativeDmaStats& nativeDmaStats();
+void nativeResetDmaStats();
+
+#endif
@@ -0,0 +1,102 @@
+#include "Preferences.h"
+#include <map>
+#include <string>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> PrefsNamespace;
+
+static std::map<std::string, PrefsNamespace>& store() {
+  static std::map<std::string, PrefsNamespace> namespaces;
+  return namespaces;
+}
+
+static PrefsNamespace& ns(const String& name) {
+  return store()[name.str()];
+}
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel) {
+  (void)partitionLabel;
+  if (!name) return false;
+  _namespace = name;
+  _readOnly = readOnly;
+  _started = true;
+  return true;
+}
+
+void Preferences::end() {
+  _started = false;
+}
+
+bool Preferences::clear() {
+  if (!_started || _readOnly) return false;
+  ns(_namespace).clear();
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!_started || _readOnly || !key) return false;
+  return ns(_namespace).erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+  if (!_started || !key) return false;
+  return ns(_namespace).count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  if (!_started || _readOnly || !key || (!value && len)) return 0;
+  const uint8_t* p = static_cast<const uint8_t*>(value);
+  ns(_namespace)[key].assign(p, p + len);
+  return len;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  if (!_started || !key || !buf) return 0;
+  auto& n = ns(_namespace);
+  auto it = n.find(key);
+  if (it == n.end() || it->second.size() > maxLen) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (!_started || !key) return 0;
+  auto& n = ns(_namespace);
+  auto it = n.find(key);
+  return it == n.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+  int32_t value = defaultValue;
+  if (getBytesLength(key) != sizeof(value)) return defaultValue;
+  getBytes(key, &value, sizeof(value));
+  return value;
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+  uint32_t value = defaultValue;
+  if (getBytesLength(key) != sizeof(value)) return defaultValue;
+  getBytes(key, &value, sizeof(value));
+  return value;
+}
+
+size_t Preferences::putString(const char* key, const String& value) {
+  return putBytes(key, value.c_str(), value.length() + 1);
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+  size_t len = getBytesLength(key);
+  if (len == 0) return defaultValue;
+  std::vector<char> buf(len);
+  getBytes(key, buf.data(), len);
+  buf[len - 1] = '\0';
+  return String(buf.data());
+}
@@ -0,0 +1,35 @@
+#ifndef NATIVE_PREFERENCES_H
+#define NATIVE_PREFERENCES_H
+
+#include <Arduino.h>
+
+/**
+ * In-memory NVS stand-in. Namespaces persist for the lifetime of the
+ * process, so begin()/end() cycles behave like a reboot-free device.
+ */
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+  void end();
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key);
+
+  size_t putBytes(const char* key, const void* value, size_t len);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+  size_t getBytesLength(const char* key);
+
+  size_t putInt(const char* key, int32_t value);
+  int32_t getInt(const char* key, int32_t defaultValue = 0);
+  size_t putUInt(const char* key, uint32_t value);
+  uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+  size_t putString(const char* key, const String& value);
+  String getString(const char* key, const String& defaultValue = String());
+
+private:
+  String _namespace;
+  bool _readOnly = false;
+  bool _started = false;
+};
+
+#endif
@@ -0,0 +1,637 @@
+#include "TFT_eSPI.h"
+#include "NativeHost.h"
+
+// ==================== Colour Helpers ====================
+static inline uint16_t swap16(uint16_t v) {
+  return (uint16_t)((v >> 8) | (v << 8));
+}
+
+static uint8_t color16to8(uint16_t c) {
+  return (uint8_t)(((c & 0xE000) >> 8) | ((c & 0x0700) >> 6) | ((c & 0x0018) >> 3));
+}
+
+static uint16_t color8to16(uint8_t c) {
+  static const uint8_t blue[] = {0, 11, 21, 31};
+  uint16_t c16 = (uint16_t)(((c & 0x1C) << 6) | ((c & 0xC0) << 5) | ((c & 0xE0) << 8));
+  c16 |= (uint16_t)(((c & 0x1C) << 3) | blue[c & 0x03]);
+  return c16;
+}
+
+// ==================== DMA Accounting ====================
+static NativeDmaStats dmaStats;
+
+const NativeDmaStats& nativeDmaStats() {
+  return dmaStats;
+}
+
+void nativeResetDmaStats() {
+  memset(&dmaStats, 0, sizeof(dmaStats));
+}
+
+// ==================== TFT_eSPI ====================
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : isDigits(false), _buf(nullptr), _width(w), _height(h), _ownsBuffer(false),
+      _vpX(0), _vpY(0), _vpW(w), _vpH(h), _xDatum(0), _yDatum(0), _rotation(0),
+      _swapBytes(false), _textColor(TFT_WHITE), _textBgColor(TFT_WHITE), _textSize(1),
+      _textDatum(TL_DATUM), _gfxFont(nullptr), _glyphAb(0), _glyphBb(0),
+      _dmaEnabled(false), _dmaPending(false), _dmaX(0), _dmaY(0), _dmaW(0), _dmaH(0),
+      _dmaSrc(nullptr) {
+  if (w > 0 && h > 0) {
+    _buf = new uint16_t[(size_t)w * h]();
+    _ownsBuffer = true;
+  }
+}
+
+TFT_eSPI::~TFT_eSPI() {
+  if (_ownsBuffer) delete[] _buf;
+}
+
+void TFT_eSPI::init(uint8_t tc) {
+  (void)tc;
+  fillScreen(TFT_BLACK);
+}
+
+// ==================== Viewport ====================
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+  int32_t x0 = max<int32_t>(x, 0), y0 = max<int32_t>(y, 0);
+  int32_t x1 = min<int32_t>(x + w, _width), y1 = min<int32_t>(y + h, _height);
+  _vpX = x0;
+  _vpY = y0;
+  _vpW = max<int32_t>(x1 - x0, 0);
+  _vpH = max<int32_t>(y1 - y0, 0);
+  _xDatum = vpDatum ? x : 0;
+  _yDatum = vpDatum ? y : 0;
+}
+
+void TFT_eSPI::resetViewport() {
+  _vpX = 0;
+  _vpY = 0;
+  _vpW = _width;
+  _vpH = _height;
+  _xDatum = 0;
+  _yDatum = 0;
+}
+
+bool TFT_eSPI::checkViewport(int32_t x, int32_t y, int32_t w, int32_t h) const {
+  x += _xDatum;
+  y += _yDatum;
+  return !(x >= _vpX + _vpW || y >= _vpY + _vpH || x + w <= _vpX || y + h <= _vpY);
+}
+
+// ==================== Primitives ====================
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  writePixel(x, y, storeColor((uint16_t)color));
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) const {
+  if (_dmaPending) dmaStats.accessViolations++;
+  if (x < 0 || y < 0 || x >= _width || y >= _height || !_buf) return 0;
+  return loadColor(_buf[y * _width + x]);
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (!_buf) return;
+  x += _xDatum;
+  y += _yDatum;
+  int32_t x0 = max<int32_t>(x, _vpX), y0 = max<int32_t>(y, _vpY);
+  int32_t x1 = min<int32_t>(x + w, _vpX + _vpW), y1 = min<int32_t>(y + h, _vpY + _vpH);
+  if (x0 >= x1 || y0 >= y1) return;
+  if (_dmaPending) dmaAccessViolation();
+  uint16_t c = storeColor((uint16_t)color);
+  for (int32_t yy = y0; yy < y1; yy++) {
+    uint16_t* row = _buf + yy * _width;
+    for (int32_t xx = x0; xx < x1; xx++) row[xx] = c;
+  }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  uint16_t c = storeColor((uint16_t)color);
+  int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  while (true) {
+    writePixel(x0, y0, c);
+    if (x0 == x1 && y0 == y1) break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  uint16_t c = storeColor((uint16_t)color);
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  writePixel(x0, y0 + r, c);
+  writePixel(x0, y0 - r, c);
+  writePixel(x0 + r, y0, c);
+  writePixel(x0 - r, y0, c);
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    writePixel(x0 + x, y0 + y, c);
+    writePixel(x0 - x, y0 + y, c);
+    writePixel(x0 + x, y0 - y, c);
+    writePixel(x0 - x, y0 - y, c);
+    writePixel(x0 + y, y0 + x, c);
+    writePixel(x0 - y, y0 + x, c);
+    writePixel(x0 + y, y0 - x, c);
+    writePixel(x0 - y, y0 - x, c);
+  }
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners,
+                                uint32_t color) {
+  uint16_t c = storeColor((uint16_t)color);
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (corners & 0x4) { writePixel(x0 + x, y0 + y, c); writePixel(x0 + y, y0 + x, c); }
+    if (corners & 0x2) { writePixel(x0 + x, y0 - y, c); writePixel(x0 + y, y0 - x, c); }
+    if (corners & 0x8) { writePixel(x0 - y, y0 + x, c); writePixel(x0 - x, y0 + y, c); }
+    if (corners & 0x1) { writePixel(x0 - y, y0 - x, c); writePixel(x0 - x, y0 - y, c); }
+  }
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners,
+                                int32_t delta, uint32_t color) {
+  int32_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  int32_t px = x, py = y;
+  delta++;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < (y + 1)) {
+      if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color) {
+  drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r,
+                             uint32_t color) {
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r,
+                             uint32_t color) {
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                            int32_t x2, int32_t y2, uint32_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                            int32_t x2, int32_t y2, uint32_t color) {
+  // Sort by y (y0 <= y1 <= y2)
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+  if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+  if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+  if (y0 == y2) {
+    int32_t a = x0, b = x0;
+    if (x1 < a) a = x1; else if (x1 > b) b = x1;
+    if (x2 < a) a = x2; else if (x2 > b) b = x2;
+    drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0;
+  int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0, last = (y1 == y2) ? y1 : y1 - 1, y;
+
+  for (y = y0; y <= last; y++) {
+    int32_t a = x0 + sa / dy01;
+    int32_t b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    int32_t a = x1 + sa / dy12;
+    int32_t b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+// ==================== Images ====================
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  if (!data) return;
+  for (int32_t yy = 0; yy < h; yy++) {
+    for (int32_t xx = 0; xx < w; xx++) {
+      uint16_t raw = data[yy * w + xx];
+      writePixel(x + xx, y + yy, storeColor(_swapBytes ? raw : swap16(raw)));
+    }
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data,
+                         uint16_t transparent) {
+  if (!data) return;
+  for (int32_t yy = 0; yy < h; yy++) {
+    for (int32_t xx = 0; xx < w; xx++) {
+      uint16_t raw = data[yy * w + xx];
+      if (raw == transparent) continue;
+      writePixel(x + xx, y + yy, storeColor(_swapBytes ? raw : swap16(raw)));
+    }
+  }
+}
+
+// ==================== DMA ====================
+bool TFT_eSPI::initDMA(bool ctrl_cs) {
+  (void)ctrl_cs;
+  _dmaEnabled = _buf != nullptr;
+  return _dmaEnabled;
+}
+
+void TFT_eSPI::deInitDMA() {
+  dmaWait();
+  _dmaEnabled = false;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* image,
+                            uint16_t* buffer) {
+  if (!_dmaEnabled || !image) return;
+
+  // Clip to the viewport like the library; a clipped image must be sent from buffer
+  x += _xDatum;
+  y += _yDatum;
+  int32_t x0 = max<int32_t>(x, _vpX), y0 = max<int32_t>(y, _vpY);
+  int32_t x1 = min<int32_t>(x + w, _vpX + _vpW), y1 = min<int32_t>(y + h, _vpY + _vpH);
+  if (x0 >= x1 || y0 >= y1) return;
+  int32_t dw = x1 - x0, dh = y1 - y0;
+
+  dmaWait();  // One transfer in flight: queueing waits for the previous one
+
+  uint16_t* src = image;
+  if (buffer || dw != w || dh != h) {
+    if (!buffer) buffer = image;  // The library compacts a clipped image in place
+    for (int32_t yy = 0; yy < dh; yy++) {
+      memmove(buffer + yy * dw, image + (y0 - y + yy) * w + (x0 - x), dw * sizeof(uint16_t));
+    }
+    src = buffer;
+  }
+  if (_swapBytes) {
+    // The library swaps in place so the bytes go out in panel order
+    for (int32_t i = 0; i < dw * dh; i++) src[i] = swap16(src[i]);
+  }
+
+  _dmaPending = true;
+  _dmaX = x0;
+  _dmaY = y0;
+  _dmaW = dw;
+  _dmaH = dh;
+  _dmaSrc = src;
+  _dmaSnapshot.assign(src, src + dw * dh);
+  dmaStats.queued++;
+  dmaStats.pixels += (uint32_t)(dw * dh);
+}
+
+void TFT_eSPI::dmaWait() {
+  if (_dmaPending) dmaComplete();
+}
+
+void TFT_eSPI::dmaAccessViolation() {
+  dmaStats.accessViolations++;
+  dmaComplete();
+}
+
+void TFT_eSPI::dmaComplete() {
+  _dmaPending = false;
+  // The panel receives whatever the buffer holds by the time DMA reads it
+  if (memcmp(_dmaSrc, _dmaSnapshot.data(), _dmaSnapshot.size() * sizeof(uint16_t)) != 0) {
+    dmaStats.reuseViolations++;
+  }
+  for (int32_t yy = 0; yy < _dmaH; yy++) {
+    uint16_t* row = _buf + (_dmaY + yy) * _width + _dmaX;
+    const uint16_t* src = _dmaSrc + yy * _dmaW;
+    for (int32_t xx = 0; xx < _dmaW; xx++) row[xx] = swap16(src[xx]);
+  }
+  dmaStats.completed++;
+}
+
+// ==================== Text ====================
+void TFT_eSPI::setFreeFont(const GFXfont* font) {
+  _gfxFont = font;
+  _glyphAb = 0;
+  _glyphBb = 0;
+  if (!font) return;
+  uint16_t numChars = font->last - font->first;
+  for (uint16_t c = 0; c < numChars; c++) {
+    const GFXglyph* g = &font->glyph[c];
+    int8_t ab = -g->yOffset;
+    if (ab > _glyphAb) _glyphAb = ab;
+    int8_t bb = g->height - ab;
+    if (bb > _glyphBb) _glyphBb = bb;
+  }
+}
+
+void TFT_eSPI::setTextFont(uint8_t font) {
+  (void)font;
+  _gfxFont = nullptr;
+}
+
+int16_t TFT_eSPI::textWidth(const char* string) {
+  if (!string) return 0;
+  int32_t width = 0;
+  if (!_gfxFont) {
+    width = (int32_t)strlen(string) * 6;
+  } else {
+    while (*string) {
+      uint8_t c = (uint8_t)*string++;
+      if (c < _gfxFont->first || c > _gfxFont->last) continue;
+      const GFXglyph* g = &_gfxFont->glyph[c - _gfxFont->first];
+      // Last glyph: use its inked extent, which can exceed xAdvance
+      if (*string || isDigits) width += g->xAdvance;
+      else width += g->xOffset + g->width;
+    }
+  }
+  return (int16_t)(width * _textSize);
+}
+
+int16_t TFT_eSPI::fontHeight() {
+  return (int16_t)((_gfxFont ? _gfxFont->yAdvance : 8) * _textSize);
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t c, int32_t x, int32_t y) {
+  if (!_gfxFont) return (int16_t)(6 * _textSize);
+  if (c < _gfxFont->first || c > _gfxFont->last) return 0;
+
+  const GFXglyph* g = &_gfxFont->glyph[c - _gfxFont->first];
+  const uint8_t* bitmap = _gfxFont->bitmap;
+  uint32_t bo = g->bitmapOffset;
+  uint16_t color = storeColor(_textColor);
+  uint8_t bits = 0, bit = 0;
+
+  for (int32_t yy = 0; yy < g->height; yy++) {
+    for (int32_t xx = 0; xx < g->width; xx++) {
+      if (!(bit++ & 7)) bits = bitmap[bo++];
+      if (bits & 0x80) {
+        if (_textSize == 1) {
+          writePixel(x + g->xOffset + xx, y + g->yOffset + yy, color);
+        } else {
+          fillRect(x + (g->xOffset + xx) * _textSize, y + (g->yOffset + yy) * _textSize,
+                   _textSize, _textSize, _textColor);
+        }
+      }
+      bits <<= 1;
+    }
+  }
+  return (int16_t)(g->xAdvance * _textSize);
+}
+
+int16_t TFT_eSPI::drawString(const char* string, int32_t x, int32_t y) {
+  if (!string) return 0;
+  int32_t cwidth = textWidth(string);
+  int32_t cheight = fontHeight();
+  int32_t baseline = 0;
+
+  if (_gfxFont) {
+    cheight = _glyphAb * _textSize;
+    y += cheight;  // GFX glyphs are positioned from the baseline
+    baseline = cheight;
+    if (_textDatum == BL_DATUM || _textDatum == BC_DATUM || _textDatum == BR_DATUM) {
+      cheight += _glyphBb * _textSize;
+    }
+  }
+
+  switch (_textDatum) {
+    case TC_DATUM: x -= cwidth / 2; break;
+    case TR_DATUM: x -= cwidth; break;
+    case ML_DATUM: y -= cheight / 2; break;
+    case MC_DATUM: x -= cwidth / 2; y -= cheight / 2; break;
+    case MR_DATUM: x -= cwidth; y -= cheight / 2; break;
+    case BL_DATUM: y -= cheight; break;
+    case BC_DATUM: x -= cwidth / 2; y -= cheight; break;
+    case BR_DATUM: x -= cwidth; y -= cheight; break;
+    case L_BASELINE: y -= baseline; break;
+    case C_BASELINE: x -= cwidth / 2; y -= baseline; break;
+    case R_BASELINE: x -= cwidth; y -= baseline; break;
+    default: break;
+  }
+
+  int32_t sumX = 0;
+  while (*string) {
+    sumX += drawChar((uint8_t)*string++, x + sumX, y);
+  }
+  isDigits = false;
+  return (int16_t)sumX;
+}
+
+int16_t TFT_eSPI::drawNumber(long number, int32_t x, int32_t y) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%ld", number);
+  isDigits = true;
+  return drawString(buf, x, y);
+}
+
+int16_t TFT_eSPI::drawFloat(float number, uint8_t decimals, int32_t x, int32_t y) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.*f", decimals > 7 ? 7 : decimals, number);
+  isDigits = true;
+  return drawString(buf, x, y);
+}
+
+// ==================== TFT_eSprite ====================
+// TFT_eSPI's default 4-bit palette
+static const uint16_t DEFAULT_4BIT_PALETTE[16] = {
+  TFT_BLACK, TFT_BROWN, TFT_RED, TFT_ORANGE, TFT_YELLOW, TFT_GREEN, TFT_BLUE, TFT_PURPLE,
+  TFT_DARKGREY, TFT_WHITE, TFT_CYAN, TFT_MAGENTA, TFT_MAROON, TFT_DARKGREEN, TFT_NAVY, TFT_PINK
+};
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft)
+    : TFT_eSPI(0, 0), _tft(tft), _bpp(16), _created(false), _bitmapFg(TFT_WHITE),
+      _bitmapBg(TFT_BLACK) {
+  memcpy(_palette, DEFAULT_4BIT_PALETTE, sizeof(_palette));
+}
+
+TFT_eSprite::~TFT_eSprite() {
+  deleteSprite();
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  (void)frames;
+  if (_created) return _buf;
+  if (w <= 0 || h <= 0) return nullptr;
+  _buf = new uint16_t[(size_t)w * h]();
+  _width = w;
+  _height = h;
+  _ownsBuffer = true;
+  _created = true;
+  if (_bpp == 4) memcpy(_palette, DEFAULT_4BIT_PALETTE, sizeof(_palette));
+  resetViewport();
+  return _buf;
+}
+
+void TFT_eSprite::deleteSprite() {
+  if (!_created) return;
+  delete[] _buf;
+  _buf = nullptr;
+  _width = 0;
+  _height = 0;
+  _ownsBuffer = false;
+  _created = false;
+  resetViewport();
+}
+
+int8_t TFT_eSprite::setColorDepth(int8_t bits) {
+  if (bits != 1 && bits != 4 && bits != 8 && bits != 16) bits = 16;
+  _bpp = bits;
+  return _bpp;
+}
+
+void TFT_eSprite::createPalette(const uint16_t* palette, uint8_t colors) {
+  memcpy(_palette, DEFAULT_4BIT_PALETTE, sizeof(_palette));
+  if (!palette) return;
+  for (uint8_t i = 0; i < colors && i < 16; i++) _palette[i] = palette[i];
+}
+
+void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color) {
+  _palette[index & 0x0F] = color;
+}
+
+uint16_t TFT_eSprite::getPaletteColor(uint8_t index) const {
+  return _palette[index & 0x0F];
+}
+
+uint16_t TFT_eSprite::readPixelValue(int32_t x, int32_t y) const {
+  x += _xDatum;
+  y += _yDatum;
+  if (x < _vpX || y < _vpY || x >= _vpX + _vpW || y >= _vpY + _vpH || !_buf) return 0xFF;
+  return _buf[y * _width + x];
+}
+
+size_t TFT_eSprite::bufferBytes() const {
+  return ((size_t)_width * _height * _bpp + 7) / 8;
+}
+
+uint16_t TFT_eSprite::storeColor(uint16_t color) const {
+  if (_bpp == 8) return color8to16(color16to8(color));
+  if (_bpp == 1) return color ? _bitmapFg : _bitmapBg;  // Any non-zero colour sets the bit
+  if (_bpp == 4) return color & 0x0F;                   // Colours are palette indices
+  return color;
+}
+
+uint16_t TFT_eSprite::loadColor(uint16_t stored) const {
+  return _bpp == 4 ? _palette[stored & 0x0F] : stored;
+}
+
+void* TFT_eSprite::getPointer() {
+  if (!_created) return nullptr;
+  size_t n = (size_t)_width * _height;
+  if (_bpp == 16) {
+    _devBuf.resize(n * sizeof(uint16_t));
+    uint16_t* out = (uint16_t*)_devBuf.data();
+    for (size_t i = 0; i < n; i++) out[i] = swap16(_buf[i]);
+  } else if (_bpp == 8) {
+    _devBuf.resize(n);
+    for (size_t i = 0; i < n; i++) _devBuf[i] = color16to8(_buf[i]);
+  } else if (_bpp == 1) {
+    int32_t stride = (_width + 7) / 8;
+    _devBuf.assign((size_t)stride * _height, 0);
+    for (int32_t y = 0; y < _height; y++) {
+      for (int32_t x = 0; x < _width; x++) {
+        if (_buf[y * _width + x] == _bitmapFg) _devBuf[y * stride + x / 8] |= 0x80 >> (x & 7);
+      }
+    }
+  } else {
+    // Two pixels per byte, even pixel index in the high nibble
+    _devBuf.assign((n + 1) / 2, 0);
+    for (size_t i = 0; i < n; i++) _devBuf[i / 2] |= (_buf[i] & 0x0F) << ((i & 1) ? 0 : 4);
+  }
+  return _devBuf.data();
+}
+
+void TFT_eSprite::fillSprite(uint32_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  if (!_created || !_tft) return;
+  for (int32_t yy = 0; yy < _height; yy++) {
+    for (int32_t xx = 0; xx < _width; xx++) {
+      _tft->drawPixel(x + xx, y + yy, loadColor(_buf[yy * _width + xx]));
+    }
+  }
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  if (!_created || !_tft) return;
+  uint16_t key = storeColor(transparent);
+  for (int32_t yy = 0; yy < _height; yy++) {
+    for (int32_t xx = 0; xx < _width; xx++) {
+      uint16_t c = _buf[yy * _width + xx];
+      if (c != key) _tft->drawPixel(x + xx, y + yy, loadColor(c));
+    }
+  }
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw,
+                             int32_t sh) {
+  if (!_created || !_tft) return false;
+  int32_t x0 = max<int32_t>(sx, 0), y0 = max<int32_t>(sy, 0);
+  int32_t x1 = min<int32_t>(sx + sw, _width), y1 = min<int32_t>(sy + sh, _height);
+  if (x0 >= x1 || y0 >= y1) return false;
+  for (int32_t yy = y0; yy < y1; yy++) {
+    for (int32_t xx = x0; xx < x1; xx++) {
+      _tft->drawPixel(tx + xx - sx, ty + yy - sy, loadColor(_buf[yy * _width + xx]));
+    }
+  }
+  return true;
+}
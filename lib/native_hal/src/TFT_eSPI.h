@@ -0,0 +1,288 @@
+#ifndef NATIVE_TFT_ESPI_H
+#define NATIVE_TFT_ESPI_H
+
+/**
+ * Headless TFT_eSPI for env:native.
+ *
+ * TFT_eSPI renders into an in-memory 320x240 RGB565 framebuffer and
+ * TFT_eSprite into its own off-screen buffer. Pixels are stored as plain
+ * RGB565 values; pushImage() applies the same byte-order rule as the real
+ * library (arrays are byte-swapped unless setSwapBytes(true) is set), so
+ * the framebuffer shows the colours the panel would.
+ *
+ * 4-bit sprites store palette indices: drawing colours are indices 0-15 and
+ * readPixel()/pushSprite() look them up in the sprite's palette.
+ *
+ * Free (GFX) fonts are rasterised exactly. The built-in bitmap fonts are
+ * measured (6px per glyph) but not drawn.
+ *
+ * DMA is modelled as a queue with one transfer in flight, matching the ESP32
+ * SPI driver. A transfer reaches the framebuffer when it completes: on
+ * dmaWait(), the next pushImageDMA() or deInitDMA(). Drawing to the TFT while
+ * a transfer is outstanding, or changing its source buffer before it
+ * completes, is counted in nativeDmaStats() (see NativeHost.h).
+ */
+
+#include <Arduino.h>
+#include <vector>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 320
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 240
+#endif
+
+// ==================== Colours ====================
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+#define TFT_TRANSPARENT 0x0120
+
+// ==================== Text Datums ====================
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+// ==================== GFX Fonts ====================
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t* bitmap;
+  GFXglyph* glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+// ==================== TFT_eSPI ====================
+class TFT_eSPI {
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0) { init(tc); }
+  void setRotation(uint8_t r) { _rotation = r; }
+  uint8_t getRotation() const { return _rotation; }
+  int16_t width() const { return (int16_t)_width; }
+  int16_t height() const { return (int16_t)_height; }
+
+  void startWrite() {}
+  void endWrite() {}
+
+  // Viewport: clips all drawing; with vpDatum the origin moves to (x, y)
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport();
+  bool checkViewport(int32_t x, int32_t y, int32_t w, int32_t h) const;
+  int32_t getViewportX() const { return _vpX; }
+  int32_t getViewportY() const { return _vpY; }
+  int32_t getViewportWidth() const { return _vpW; }
+  int32_t getViewportHeight() const { return _vpH; }
+
+  // Primitives
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  uint16_t readPixel(int32_t x, int32_t y) const;
+  void fillScreen(uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                    int32_t x2, int32_t y2, uint32_t color);
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                    int32_t x2, int32_t y2, uint32_t color);
+
+  // Images
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() const { return _swapBytes; }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data,
+                 uint16_t transparent);
+
+  // DMA
+  bool initDMA(bool ctrl_cs = false);
+  void deInitDMA();
+  // image must stay untouched until the transfer completes unless buffer is given,
+  // in which case image is copied into buffer first (after waiting for the previous one)
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* image,
+                    uint16_t* buffer = nullptr);
+  bool dmaBusy() const { return _dmaPending; }
+  void dmaWait();
+
+  // Text
+  void setTextColor(uint16_t color) { _textColor = color; _textBgColor = color; }
+  void setTextColor(uint16_t fg, uint16_t bg, bool bgFill = false) {
+    _textColor = fg;
+    _textBgColor = bg;
+    (void)bgFill;
+  }
+  void setTextSize(uint8_t size) { _textSize = size > 0 ? size : 1; }
+  void setTextDatum(uint8_t datum) { _textDatum = datum; }
+  uint8_t getTextDatum() const { return _textDatum; }
+  void setFreeFont(const GFXfont* font);
+  void setTextFont(uint8_t font);
+  int16_t textWidth(const char* string);
+  int16_t textWidth(const String& string) { return textWidth(string.c_str()); }
+  int16_t fontHeight();
+  int16_t drawString(const char* string, int32_t x, int32_t y);
+  int16_t drawString(const String& string, int32_t x, int32_t y) {
+    return drawString(string.c_str(), x, y);
+  }
+  int16_t drawChar(uint16_t c, int32_t x, int32_t y);
+  int16_t drawNumber(long number, int32_t x, int32_t y);
+  int16_t drawFloat(float number, uint8_t decimals, int32_t x, int32_t y);
+
+  // Set by drawNumber()/drawFloat() so a trailing digit is measured by its
+  // xAdvance (no jiggle in monospaced figures); drawString() clears it
+  bool isDigits;
+
+  // Host-only: raw access to the pixel store
+  const uint16_t* frameBuffer() const { return _buf; }
+
+protected:
+  // Colour as it will be stored (sprites reduce it to their colour depth)
+  virtual uint16_t storeColor(uint16_t color) const { return color; }
+  // RGB565 colour of a stored value (4-bit sprites map indices through their palette)
+  virtual uint16_t loadColor(uint16_t stored) const { return stored; }
+
+  void writePixel(int32_t x, int32_t y, uint16_t color) {
+    if (_dmaPending) dmaAccessViolation();
+    x += _xDatum;
+    y += _yDatum;
+    if (x < _vpX || y < _vpY || x >= _vpX + _vpW || y >= _vpY + _vpH || !_buf) return;
+    _buf[y * _width + x] = color;
+  }
+  void dmaAccessViolation();
+  void dmaComplete();
+  void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners, uint32_t color);
+  void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corners,
+                        int32_t delta, uint32_t color);
+
+  uint16_t* _buf;
+  int32_t _width;
+  int32_t _height;
+  bool _ownsBuffer;
+
+  // Clip rectangle (absolute) and drawing origin offset
+  int32_t _vpX, _vpY, _vpW, _vpH;
+  int32_t _xDatum, _yDatum;
+
+private:
+  uint8_t _rotation;
+  bool _swapBytes;
+  uint16_t _textColor;
+  uint16_t _textBgColor;
+  uint8_t _textSize;
+  uint8_t _textDatum;
+  const GFXfont* _gfxFont;
+  int16_t _glyphAb;  // Max glyph height above baseline
+  int16_t _glyphBb;  // Max glyph depth below baseline
+
+  // Outstanding DMA transfer (the region is already clipped to the screen)
+  bool _dmaEnabled;
+  bool _dmaPending;
+  int32_t _dmaX, _dmaY, _dmaW, _dmaH;
+  const uint16_t* _dmaSrc;
+  std::vector<uint16_t> _dmaSnapshot;  // Source as it was when queued
+};
+
+// ==================== TFT_eSprite ====================
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite() override;
+
+  void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return _created; }
+  // Pixel data in the device layout: 16-bit byte-swapped RGB565, 8-bit RGB332,
+  // 4-bit indices two per byte (even pixel in the high nibble, rows not padded),
+  // 1-bit packed MSB-first rows padded to whole bytes. On the host this is a
+  // snapshot taken by the call; redraw, then call again to see changes.
+  void* getPointer();
+
+  int8_t setColorDepth(int8_t bits);
+  int8_t getColorDepth() const { return _bpp; }
+  // 1-bit sprites: colours for set / clear bits
+  void setBitmapColor(uint16_t fg, uint16_t bg) {
+    _bitmapFg = fg;
+    _bitmapBg = bg;
+  }
+
+  void fillSprite(uint32_t color);
+  void pushSprite(int32_t x, int32_t y);
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+  // Push only the sw x sh window at (sx, sy) of the sprite, placed at (tx, ty)
+  bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+  // 4-bit sprites: palette (nullptr restores the default one)
+  void createPalette(const uint16_t* palette = nullptr, uint8_t colors = 16);
+  void setPaletteColor(uint8_t index, uint16_t color);
+  uint16_t getPaletteColor(uint8_t index) const;
+  // Stored value at (x, y) (the palette index for 4-bit sprites); 0xFF outside the viewport
+  uint16_t readPixelValue(int32_t x, int32_t y) const;
+
+  // Bytes the sprite would occupy on the device at its colour depth
+  size_t bufferBytes() const;
+
+protected:
+  uint16_t storeColor(uint16_t color) const override;
+  uint16_t loadColor(uint16_t stored) const override;
+
+private:
+  TFT_eSPI* _tft;
+  int8_t _bpp;
+  bool _created;
+  uint16_t _bitmapFg;
+  uint16_t _bitmapBg;
+  uint16_t _palette[16];
+  std::vector<uint8_t> _devBuf;  // Backing store for getPointer()
+};
+
+#endif
@@ -0,0 +1,21 @@
+#include "WiFi.h"
+#include "ESPmDNS.h"
+
+WiFiClass WiFi;
+MDNSResponder MDNS;
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _octets[0], _octets[1], _octets[2], _octets[3]);
+  return String(buf);
+}
+
+bool WiFiClass::config(IPAddress local, IPAddress gateway, IPAddress subnet,
+                       IPAddress dns1, IPAddress dns2) {
+  (void)gateway;
+  (void)subnet;
+  (void)dns1;
+  (void)dns2;
+  _ip = local;
+  return true;
+}
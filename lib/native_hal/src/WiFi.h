@@ -0,0 +1,44 @@
+#ifndef NATIVE_WIFI_H
+#define NATIVE_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+class IPAddress {
+public:
+  IPAddress() : IPAddress(0, 0, 0, 0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _octets{a, b, c, d} {}
+  String toString() const;
+  uint8_t operator[](int i) const { return _octets[i]; }
+
+private:
+  uint8_t _octets[4];
+};
+
+// Always-connected station; the host has no radio to lose
+class WiFiClass {
+public:
+  bool disconnect(bool wifiOff = false) { (void)wifiOff; return true; }
+  bool reconnect() { return true; }
+  bool config(IPAddress local, IPAddress gateway, IPAddress subnet,
+              IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress());
+  IPAddress localIP() const { return _ip; }
+  wl_status_t status() const { return WL_CONNECTED; }
+  bool setSleep(bool enabled) { (void)enabled; return true; }
+  int8_t RSSI() const { return -50; }
+
+private:
+  IPAddress _ip = IPAddress(127, 0, 0, 1);
+};
+
+extern WiFiClass WiFi;
+
+#endif
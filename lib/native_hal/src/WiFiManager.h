@@ -0,0 +1,20 @@
+#ifndef NATIVE_WIFIMANAGER_H
+#define NATIVE_WIFIMANAGER_H
+
+#include <Arduino.h>
+
+// Connects immediately; there is no captive portal on the host
+class WiFiManager {
+public:
+  void setConnectTimeout(unsigned long seconds) { (void)seconds; }
+  void setConnectRetries(uint8_t retries) { (void)retries; }
+  void setConfigPortalTimeout(unsigned long seconds) { (void)seconds; }
+  bool autoConnect(const char* apName = nullptr, const char* apPassword = nullptr) {
+    (void)apName;
+    (void)apPassword;
+    return true;
+  }
+  void resetSettings() {}
+};
+
+#endif
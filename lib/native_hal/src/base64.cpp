@@ -0,0 +1,53 @@
+#include "mbedtls/base64.h"
+
+static int decodeChar(unsigned char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;
+}
+
+extern "C" int mbedtls_base64_decode(unsigned char* dst, size_t dlen, size_t* olen,
+                                     const unsigned char* src, size_t slen) {
+  // First pass: validate and count significant characters
+  size_t n = 0, pad = 0;
+  for (size_t i = 0; i < slen; i++) {
+    unsigned char c = src[i];
+    if (c == ' ' || c == '\r' || c == '\n') continue;
+    if (c == '=') {
+      if (++pad > 2) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+      continue;
+    }
+    if (pad || decodeChar(c) < 0) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+    n++;
+  }
+
+  size_t needed = (n * 6) / 8;
+  if (needed == 0) {
+    *olen = 0;
+    return 0;
+  }
+  if (!dst || dlen < needed) {
+    *olen = needed;
+    return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+  }
+
+  // Second pass: decode
+  unsigned int acc = 0;
+  int bits = 0;
+  size_t out = 0;
+  for (size_t i = 0; i < slen; i++) {
+    int v = decodeChar(src[i]);
+    if (v < 0) continue;
+    acc = (acc << 6) | (unsigned int)v;
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      dst[out++] = (unsigned char)((acc >> bits) & 0xFF);
+    }
+  }
+  *olen = out;
+  return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * Host runner for env:native.
+ *
+ * Boots the firmware (setup()), then calls loop() while stepping the
+ * simulated clock, and optionally dumps the final screen as a PPM.
+ *
+ *   program [seconds] [screen.ppm]
+ */
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "NativeHost.h"
+
+// Step between loop() calls; the device loop spins far faster than this,
+// but 1 ms is below every interval the firmware schedules against.
+static const unsigned long LOOP_STEP_MS = 1;
+
+extern TFT_eSPI tft;
+
+// ==================== Display Access ====================
+const uint16_t* nativeFramebuffer() {
+  tft.dmaWait();  // Land any outstanding transfer
+  return tft.frameBuffer();
+}
+
+int nativeFramebufferWidth() {
+  return tft.width();
+}
+
+int nativeFramebufferHeight() {
+  return tft.height();
+}
+
+bool nativeWritePpm(const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+
+  const int w = nativeFramebufferWidth();
+  const int h = nativeFramebufferHeight();
+  const uint16_t* fb = nativeFramebuffer();
+  fprintf(f, "P6\n%d %d\n255\n", w, h);
+  for (int i = 0; i < w * h; i++) {
+    uint16_t c = fb[i];
+    uint8_t rgb[3] = {
+      (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+      (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+      (uint8_t)((c & 0x1F) * 255 / 31)
+    };
+    fwrite(rgb, 1, 3, f);
+  }
+  return fclose(f) == 0;
+}
+
+// ==================== Entry Point ====================
+// Unit tests under test/ bring their own main() and call into src/ directly
+#ifndef UNIT_TEST
+int main(int argc, char** argv) {
+  unsigned long runMs = (argc > 1) ? strtoul(argv[1], nullptr, 10) * 1000UL : 10000UL;
+  const char* ppmPath = (argc > 2) ? argv[2] : nullptr;
+
+  setup();
+
+  unsigned long start = millis();
+  while (millis() - start < runMs) {
+    loop();
+    nativeAdvanceMillis(LOOP_STEP_MS);
+  }
+
+  if (ppmPath) {
+    if (!nativeWritePpm(ppmPath)) {
+      fprintf(stderr, "Failed to write %s\n", ppmPath);
+      return 1;
+    }
+    printf("Screen written to %s\n", ppmPath);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,21 @@
+#ifndef NATIVE_MBEDTLS_BASE64_H
+#define NATIVE_MBEDTLS_BASE64_H
+
+#include <stddef.h>
+
+#define MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL  -0x002A
+#define MBEDTLS_ERR_BASE64_INVALID_CHARACTER -0x002C
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Same contract as mbedTLS: on BUFFER_TOO_SMALL, *olen holds the required size
+int mbedtls_base64_decode(unsigned char* dst, size_t dlen, size_t* olen,
+                          const unsigned char* src, size_t slen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef NATIVE_PGMSPACE_H
+#define NATIVE_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Flash and RAM share one address space on the host, so PROGMEM is a no-op
+// and the pgm_read_* accessors are plain loads.
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define F(s) (s)
+
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr)   (*(const void* const*)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#endif
@@ -0,0 +1,41 @@
+#include "freertos/queue.h"
+#include <string.h>
+#include <vector>
+
+struct NativeQueue {
+  std::vector<uint8_t> items;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  UBaseType_t head = 0;
+  UBaseType_t count = 0;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  NativeQueue* q = new NativeQueue();
+  q->items.resize(length * itemSize);
+  q->length = length;
+  q->itemSize = itemSize;
+  return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t ticksToWait) {
+  (void)ticksToWait;
+  if (!q || q->count == q->length) return errQUEUE_FULL;
+  UBaseType_t slot = (q->head + q->count) % q->length;
+  memcpy(&q->items[slot * q->itemSize], item, q->itemSize);
+  q->count++;
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t ticksToWait) {
+  (void)ticksToWait;
+  if (!q || q->count == 0) return pdFALSE;
+  memcpy(item, &q->items[q->head * q->itemSize], q->itemSize);
+  q->head = (q->head + 1) % q->length;
+  q->count--;
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+  return q ? q->count : 0;
+}
@@ -3,11 +3,33 @@
 #include "config.h"
 #include "notif_screen.h"
 #include "reminder_screen.h"
+#include "screen.h"
 #include "led_control.h"
 #include "motor_control.h"
+#include "render_metrics.h"
+#include "frame_scheduler.h"
+#include "sprite_pool.h"
+#include "icon_cache.h"
+#include "command_queue.h"
+#include "tasks.h"
+#include "power.h"
+#include "heap_stats.h"
+#include "notif_history.h"
+#include "pc_stats.h"
+#include "reminder_snapshot.h"
+#include "calendar_screen.h"
 
 AsyncWebServer server(80);
 
+// Handlers run on the AsyncTCP task: state changes go through the command queue
+static bool queueCommand(AsyncWebServerRequest* request, const Command& cmd) {
+  if (!pushCommand(cmd)) {
+    request->send(503, "application/json", "{\"error\":\"busy, try again\"}");
+    return false;
+  }
+  return true;
+}
+
 // ==================== Setup Routes ====================
 void setupApiRoutes() {
   // Screen control
@@ -31,10 +53,27 @@ void setupApiRoutes() {
   // Gaming mode / PC stats
   server.on("/gaming", HTTP_POST, handleGamingMode);
   server.on("/pcstats", HTTP_POST, handlePcStats);
+  server.on("/pcstats", HTTP_GET, handleGetPcStats);
 
   // Calendar month
   server.on("/calmonth", HTTP_POST, handleCalendarMonth);
 
+  // Uploaded app icons
+  server.on("/icon", HTTP_POST, handleUploadIcon);
+  server.on("/icons", HTTP_GET, handleIconCache);
+
+  // Render metrics
+  server.on("/metrics", HTTP_GET, handleMetrics);
+  server.on("/frames", HTTP_GET, handleFrameStats);
+  server.on("/sprites", HTTP_GET, handleSpritePool);
+  server.on("/queue", HTTP_GET, handleCommandQueue);
+  server.on("/tasks", HTTP_GET, handleTasks);
+  server.on("/power", HTTP_GET, handlePower);
+  server.on("/heap", HTTP_GET, handleHeap);
+  server.on("/history", HTTP_GET, handleNotifHistory);
+  server.on("/notifstats", HTTP_GET, handleNotifStats);
+  server.on("/calcache", HTTP_GET, handleCalendarCache);
+
   // Root
   server.on("/", HTTP_GET, handleRoot);
 
@@ -42,71 +81,101 @@ void setupApiRoutes() {
   Serial.println("Ready! http://notification.local/");
 }
 
+// ==================== Request Text ====================
+// Handlers reset the request arena (arena.h) on entry and keep their text
+// there or as views into the request's own parameters, not in Strings.
+
+// A parameter's value as a view into the request; body parameters first,
+// then the query string if query is set
+static TextSlice requestParam(AsyncWebServerRequest* request, const char* name,
+                              const char* fallback, bool query = false) {
+  const AsyncWebParameter* p = request->getParam(name, true);
+  if (p == nullptr && query) {
+    p = request->getParam(name);
+  }
+  return p != nullptr ? textSlice(p->value()) : textSlice(fallback);
+}
+
+// GitHub "from" actions, shortened for display
+static const char* const GITHUB_ACTION_REWRITES[][2] = {
+  {"wrote a ", ""},                                        // "wrote a review comment" -> "review comment"
+  {"approved your pull request", "approved"},
+  {"requested changes on your pull request", "requested changes"},
+  {"commented on your pull request", "commented"},
+  {"mentioned you on ", "mentioned in "},
+  {"on your pull request", ""},
+  {"on your ", ""},
+  {"your ", ""},
+};
+
 // ==================== Notification Handlers ====================
 void handleFormNotify(AsyncWebServerRequest* request) {
-  String app = request->hasParam("app", true) ? request->getParam("app", true)->value() : "App";
-  String from_raw = request->hasParam("from", true) ? request->getParam("from", true)->value() : "";
-  String message = request->hasParam("message", true) ? request->getParam("message", true)->value() : "Notification";
-  String priority = request->hasParam("priority", true) ? request->getParam("priority", true)->value() : "";
+  arenaReset(requestArena);
+  TextSlice app = requestParam(request, "app", "App");
+  TextSlice fromRaw = requestParam(request, "from", "");
+  TextSlice message = requestParam(request, "message", "Notification");
+  TextSlice priority = requestParam(request, "priority", "");
 
-  String from = extractSender(from_raw);
+  TextSlice from = extractSender(fromRaw);
 
   // GitHub notification formatter: restructure from/message for better display
   // Input: from="@user wrote a review comment on your pull request", message="org/repo #123"
   // Output: from="user", message="review comment on org/repo #123"
-  if (app.indexOf("github") >= 0 && from.startsWith("@")) {
+  if (textFind(app, "github") >= 0 && textStartsWith(from, "@")) {
     // Extract username (everything between @ and first space)
-    int spaceIdx = from.indexOf(' ', 1);
+    int spaceIdx = textFind(from, " ", 1);
     if (spaceIdx > 1) {
-      String username = from.substring(1, spaceIdx);  // Remove @ prefix
-      String action = from.substring(spaceIdx + 1);   // Rest is the action
-      
+      TextSlice username = textSub(from, 1, spaceIdx);  // Remove @ prefix
+      TextSlice action = textSub(from, spaceIdx + 1);   // Rest is the action
+
       // Clean up common action patterns
-      action.replace("wrote a ", "");                     // "wrote a review comment" -> "review comment"
-      action.replace("approved your pull request", "approved");
-      action.replace("requested changes on your pull request", "requested changes");
-      action.replace("commented on your pull request", "commented");
-      action.replace("mentioned you on ", "mentioned in ");
-      action.replace("on your pull request", "");
-      action.replace("on your ", "");
-      action.replace("your ", "");
-      action.trim();
-      
+      for (const auto& rewrite : GITHUB_ACTION_REWRITES) {
+        action = arenaReplace(requestArena, action, rewrite[0], rewrite[1]);
+      }
+      action = textTrim(action);
+
       // Combine action with repo info
-      if (action.length() > 0 && message.length() > 0) {
-        message = action + " on " + message;
-      } else if (action.length() > 0) {
+      if (action.len > 0 && message.len > 0) {
+        message = arenaFormat(requestArena, "%.*s on %.*s", TEXT_ARGS(action), TEXT_ARGS(message));
+      } else if (action.len > 0) {
         message = action;
       }
       from = username;  // Just the username without @
     }
   }
 
-  Serial.printf("FormNotify - app: [%s], from: [%s], message: [%s], priority: [%s]\n",
-                app.c_str(), from.c_str(), message.c_str(), priority.c_str());
-
-  addNotification(app, from, message, getPriorityColor(priority.c_str()));
-  request->send(200, "application/json", "{\"status\":\"OK\"}");
+  Serial.printf("FormNotify - app: [%.*s], from: [%.*s], message: [%.*s], priority: [%.*s]\n",
+                TEXT_ARGS(app), TEXT_ARGS(from), TEXT_ARGS(message), TEXT_ARGS(priority));
+
+  Command cmd;
+  cmd.type = CMD_NOTIFY;
+  textCopy(cmd.notify.app, sizeof(cmd.notify.app), app);
+  textCopy(cmd.notify.from, sizeof(cmd.notify.from), from);
+  textCopy(cmd.notify.message, sizeof(cmd.notify.message), message);
+  cmd.notify.color = getPriorityColor(priority);
+  if (queueCommand(request, cmd)) {
+    request->send(200, "application/json", "{\"status\":\"OK\"}");
+  }
 }
 
 void handleClearAll(AsyncWebServerRequest* request) {
   Serial.println("=== CLEAR ALL NOTIFICATIONS ===");
-  clearAllNotifications();
-  request->send(200, "application/json", "{\"status\":\"cleared\"}");
+  Command cmd;
+  cmd.type = CMD_CLEAR_NOTIFS;
+  if (queueCommand(request, cmd)) {
+    request->send(200, "application/json", "{\"status\":\"cleared\"}");
+  }
 }
 
 // ==================== Reminder Handlers ====================
 void handleAddReminder(AsyncWebServerRequest* request) {
-  String message = request->hasParam("message", true) ? request->getParam("message", true)->value()
-                                                      : (request->hasParam("message") ? request->getParam("message")->value() : "");
-  String timestr = request->hasParam("time", true) ? request->getParam("time", true)->value()
-                                                   : (request->hasParam("time") ? request->getParam("time")->value() : "");
-  String limitStr = request->hasParam("limit", true) ? request->getParam("limit", true)->value()
-                                                     : (request->hasParam("limit") ? request->getParam("limit")->value() : "0");
-  String priority = request->hasParam("priority", true) ? request->getParam("priority", true)->value()
-                                                        : (request->hasParam("priority") ? request->getParam("priority")->value() : "normal");
-
-  if (timestr.length() == 0) {
+  arenaReset(requestArena);
+  TextSlice message = requestParam(request, "message", "", true);
+  TextSlice timestr = requestParam(request, "time", "", true);
+  TextSlice limitStr = requestParam(request, "limit", "0", true);
+  TextSlice priority = requestParam(request, "priority", "normal", true);
+
+  if (timestr.len == 0) {
     request->send(400, "application/json", "{\"error\":\"Missing time (yyyy-mm-dd hh:mm)\"}");
     return;
   }
@@ -117,16 +186,28 @@ void handleAddReminder(AsyncWebServerRequest* request) {
     return;
   }
 
-  int limitMins = limitStr.toInt();
-  int id = addReminder(message, when, limitMins, getPriorityColor(priority.c_str()));
-
-  if (id == -1) {
+  int limitMins = atoi(limitStr.ptr);  // Whole parameter values are terminated
+  // Claimed now, so the render task is sure to have room when it applies the add
+  if (!reserveReminderSlot()) {
     request->send(500, "application/json", "{\"error\":\"Max reminders reached\"}");
     return;
   }
 
-  Serial.printf("Added reminder id=%d msg=%s when=%ld limit=%d\n", id, message.c_str(), when, limitMins);
-  request->send(200, "application/json", String("{\"status\":\"added\",\"id\":") + String(id) + String("}"));
+  Command cmd;
+  cmd.type = CMD_ADD_REMINDER;
+  cmd.reminder.id = reserveReminderId();
+  cmd.reminder.when = when;
+  cmd.reminder.limitMins = limitMins;
+  cmd.reminder.color = getPriorityColor(priority);
+  textCopy(cmd.reminder.message, sizeof(cmd.reminder.message), message);
+  if (!queueCommand(request, cmd)) {
+    releaseReminderSlot();
+    return;
+  }
+  int id = cmd.reminder.id;
+
+  Serial.printf("Added reminder id=%d msg=%.*s when=%ld limit=%d\n", id, TEXT_ARGS(message), when, limitMins);
+  request->send(200, "application/json", arenaFormat(requestArena, "{\"status\":\"added\",\"id\":%d}", id).ptr);
 }
 
 void handleListReminders(AsyncWebServerRequest* request) {
@@ -134,18 +215,23 @@ void handleListReminders(AsyncWebServerRequest* request) {
 }
 
 void handleCompleteReminder(AsyncWebServerRequest* request) {
-  String idStr = request->hasParam("id", true) ? request->getParam("id", true)->value()
-                                               : (request->hasParam("id") ? request->getParam("id")->value() : "");
-  if (idStr.length() == 0) {
+  TextSlice idStr = requestParam(request, "id", "", true);
+  if (idStr.len == 0) {
     request->send(400, "application/json", "{\"error\":\"Missing id\"}");
     return;
   }
 
-  int id = idStr.toInt();
-  if (completeReminder(id)) {
-    request->send(200, "application/json", "{\"status\":\"completed\"}");
-  } else {
+  int id = atoi(idStr.ptr);
+  if (!hasReminder(id)) {
     request->send(404, "application/json", "{\"error\":\"not found\"}");
+    return;
+  }
+
+  Command cmd;
+  cmd.type = CMD_COMPLETE_REMINDER;
+  cmd.complete.id = id;
+  if (queueCommand(request, cmd)) {
+    request->send(200, "application/json", "{\"status\":\"completed\"}");
   }
 }
 
@@ -153,35 +239,36 @@ void handleCompleteReminder(AsyncWebServerRequest* request) {
 // Base64 decoding helper using mbedtls
 #include "mbedtls/base64.h"
 
-static bool decodeAlbumArt(const String& artData) {
-  if (artData.length() == 0) {
-    return false;
+// Decode into dst (COMMAND_BLOB_BYTES); returns the art width, 0 if invalid
+static int decodeAlbumArt(TextSlice artData, uint8_t* dst) {
+  if (artData.len == 0) {
+    return 0;
   }
 
   // Parse format: WxH;base64data
-  int semiPos = artData.indexOf(';');
+  int semiPos = textFind(artData, ";");
   if (semiPos < 0) {
     Serial.println("Album art: invalid format (no semicolon)");
-    return false;
+    return 0;
   }
 
-  String dimStr = artData.substring(0, semiPos);
-  String artB64 = artData.substring(semiPos + 1);
+  TextSlice dimStr = textSub(artData, 0, semiPos);
+  TextSlice artB64 = textSub(artData, semiPos + 1);
 
   // Parse dimensions (WxH)
-  int xPos = dimStr.indexOf('x');
+  int xPos = textFind(dimStr, "x");
   if (xPos < 0) {
     Serial.println("Album art: invalid dimensions");
-    return false;
+    return 0;
   }
 
-  int width = dimStr.substring(0, xPos).toInt();
-  int height = dimStr.substring(xPos + 1).toInt();
+  int width = atoi(dimStr.ptr);              // Stops at the 'x'
+  int height = atoi(dimStr.ptr + xPos + 1);  // Stops at the ';'
 
   // Validate dimensions
   if (width < 1 || width > ALBUM_ART_MAX_WIDTH || height != ALBUM_ART_SIZE) {
     Serial.printf("Album art: invalid size %dx%d\n", width, height);
-    return false;
+    return 0;
   }
 
   // Expected size based on dimensions
@@ -190,108 +277,184 @@ static bool decodeAlbumArt(const String& artData) {
 
   // Decode base64
   int ret = mbedtls_base64_decode(
-    (unsigned char*)albumArt,
-    sizeof(albumArt),
+    dst,
+    COMMAND_BLOB_BYTES,
     &outputLen,
-    (const unsigned char*)artB64.c_str(),
-    artB64.length()
+    (const unsigned char*)artB64.ptr,
+    artB64.len
   );
 
   if (ret != 0 || outputLen != expectedSize) {
-    Serial.printf("Album art decode failed: ret=%d, len=%d (expected %d)\n", ret, outputLen, expectedSize);
-    return false;
+    Serial.printf("Album art decode failed: ret=%d, len=%u (expected %u)\n", ret, (unsigned)outputLen,
+                  (unsigned)expectedSize);
+    return 0;
   }
 
-  // Store dimensions
-  albumArtWidth = width;
-  albumArtHeight = height;
-
-  Serial.printf("Album art decoded: %dx%d (%d bytes)\n", width, height, outputLen);
-  return true;
+  Serial.printf("Album art decoded: %dx%d (%u bytes)\n", width, height, (unsigned)outputLen);
+  return width;
 }
 
 void handleNowPlaying(AsyncWebServerRequest* request) {
-  String song = request->hasParam("song", true) ? request->getParam("song", true)->value() : "";
-  String artist = request->hasParam("artist", true) ? request->getParam("artist", true)->value() : "";
-  
-  // Use arg() for 'art' as it's typically a large body parameter
-  String artB64 = "";
-  if (request->hasArg("art")) {
-    artB64 = request->arg("art");
-  } else if (request->hasParam("art", true)) {
-    artB64 = request->getParam("art", true)->value();
-  }
+  TextSlice song = requestParam(request, "song", "");
+  TextSlice artist = requestParam(request, "artist", "");
+
+  // 'art' is a large body parameter: decode it in place, never copy it
+  TextSlice artB64 = requestParam(request, "art", "", true);
+
+  Command cmd;
+  cmd.type = CMD_NOW_PLAYING;
+  cmd.nowPlaying.artWidth = 0;
 
   // If song is empty, clear now playing (but preserve disc frame state)
-  if (song.length() == 0) {
-    nowPlayingSong = "";
-    nowPlayingArtist = "";
-    nowPlayingActive = false;
-    nowPlayingScrollPixel = 0;
-    albumArtValid = false;  // Clear album art
-    setZoneDirty(ZONE_STATUS);
-
-    Serial.println("Now Playing: cleared");
-    request->send(200, "application/json", "{\"status\":\"cleared\"}");
+  if (song.len == 0) {
+    cmd.nowPlaying.song[0] = '\0';
+    cmd.nowPlaying.artist[0] = '\0';
+    if (queueCommand(request, cmd)) {
+      Serial.println("Now Playing: cleared");
+      request->send(200, "application/json", "{\"status\":\"cleared\"}");
+    }
     return;
   }
 
-  Serial.printf("Now Playing: %s - %s (art length: %d)\n", song.c_str(), artist.c_str(), artB64.length());
-
-  // New song - start scroll from right edge
-  nowPlayingSong = song;
-  nowPlayingArtist = artist;
-  nowPlayingUpdated = millis();
-  nowPlayingScrollPixel = -320; 
-  lastScrollUpdate = millis();
-  lastDiscUpdate = millis();
-  nowPlayingActive = true;
+  Serial.printf("Now Playing: %.*s - %.*s (art length: %d)\n", TEXT_ARGS(song), TEXT_ARGS(artist), artB64.len);
+  textCopy(cmd.nowPlaying.song, sizeof(cmd.nowPlaying.song), song);
+  textCopy(cmd.nowPlaying.artist, sizeof(cmd.nowPlaying.artist), artist);
 
-  // Decode album art if provided
-  if (artB64.length() > 0) {
-    albumArtValid = decodeAlbumArt(artB64);
-  } else {
-    albumArtValid = false;
+  // Decode album art if provided (into the command blob, applied with the song)
+  if (artB64.len > 0) {
+    uint8_t* art = acquireCommandBlob();
+    if (art == nullptr) {
+      request->send(503, "application/json", "{\"error\":\"busy, try again\"}");
+      return;
+    }
+    cmd.nowPlaying.artWidth = decodeAlbumArt(artB64, art);
+    if (cmd.nowPlaying.artWidth == 0) {
+      releaseCommandBlob();
+    }
   }
 
-  setZoneDirty(ZONE_STATUS);  // Album art displays in status zone
+  if (!queueCommand(request, cmd)) {
+    if (cmd.nowPlaying.artWidth > 0) {
+      releaseCommandBlob();
+    }
+    return;
+  }
 
-  Serial.printf("Now Playing: Update done, artValid=%d\n", albumArtValid);
+  Serial.printf("Now Playing: Update queued, artValid=%d\n", cmd.nowPlaying.artWidth > 0);
   request->send(200, "application/json", "{\"status\":\"ok\"}");
 }
 
-// ==================== Screen Switch Handler ====================
-void handleScreenSwitch(AsyncWebServerRequest* request) {
-  String name = request->hasParam("name") ? request->getParam("name")->value() : "";
+// ==================== App Icon Handlers ====================
+void handleUploadIcon(AsyncWebServerRequest* request) {
+  arenaReset(requestArena);
+  TextSlice app = requestParam(request, "app", "");
+  TextSlice iconB64 = requestParam(request, "icon", "", true);
 
-  if (name == "reminder") {
-    currentScreen = SCREEN_REMINDER;
-  } else if (name == "calendar") {
-    currentScreen = SCREEN_CALENDAR;
-  } else {
-    currentScreen = SCREEN_NOTIFS;
+  if (app.len == 0 || iconB64.len == 0) {
+    request->send(400, "application/json", "{\"error\":\"Missing app or icon\"}");
+    return;
+  }
+
+  // 14x14 RGB565, big-endian pixels (same layout as album art); saved to flash here, on
+  // the network task, and handed to the render task only for its RAM copy
+  uint8_t* pixels = acquireCommandBlob();
+  if (pixels == nullptr) {
+    request->send(503, "application/json", "{\"error\":\"busy, try again\"}");
+    return;
+  }
+  size_t outputLen = 0;
+  int ret = mbedtls_base64_decode(
+    pixels,
+    COMMAND_BLOB_BYTES,
+    &outputLen,
+    (const unsigned char*)iconB64.ptr,
+    iconB64.len
+  );
+  if (ret != 0 || outputLen != ICON_CACHE_BYTES) {
+    Serial.printf("App icon decode failed: ret=%d, len=%u (expected %u)\n", ret, (unsigned)outputLen,
+                  (unsigned)ICON_CACHE_BYTES);
+    releaseCommandBlob();
+    request->send(400, "application/json",
+      arenaFormat(requestArena, "{\"error\":\"icon must be %d bytes of base64 RGB565\"}", ICON_CACHE_BYTES).ptr);
+    return;
   }
 
-  setZoneDirty(ZONE_TITLE);
-  setAllContentDirty();
+  Command cmd;
+  cmd.type = CMD_STORE_ICON;
+  textCopy(cmd.icon.app, sizeof(cmd.icon.app), app);
+  uint32_t key = saveAppIcon(cmd.icon.app, pixels);
+  if (key == 0) {
+    releaseCommandBlob();
+    request->send(500, "application/json", "{\"error\":\"icon could not be saved\"}");
+    return;
+  }
+  // Saved either way; if the queue is full the icon is read from flash on first use
+  if (!queueCommand(request, cmd)) {
+    releaseCommandBlob();
+    return;
+  }
 
+  Serial.printf("App icon saved: %s (key %08lx)\n", cmd.icon.app, (unsigned long)key);
   request->send(200, "application/json",
-    "{\"status\":\"ok\",\"screen\":\"" + String((currentScreen == SCREEN_REMINDER) ? "reminder" : (currentScreen == SCREEN_CALENDAR ? "calendar" : "notifs")) + "\"}");
+    arenaFormat(requestArena, "{\"status\":\"ok\",\"key\":\"%08lx\"}", (unsigned long)key).ptr);
+}
+
+void handleIconCache(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", iconCacheJson());
+}
+
+// ==================== Screen Switch Handler ====================
+void handleScreenSwitch(AsyncWebServerRequest* request) {
+  arenaReset(requestArena);
+  TextSlice name = textSlice(request->hasParam("name") ? request->getParam("name")->value().c_str() : "");
+
+  Command cmd;
+  cmd.type = CMD_SHOW_SCREEN;
+  if (textEquals(name, "reminder")) {
+    cmd.screen = SCREEN_REMINDER;
+  } else if (textEquals(name, "calendar")) {
+    cmd.screen = SCREEN_CALENDAR;
+  } else {
+    cmd.screen = SCREEN_NOTIFS;
+  }
+
+  if (queueCommand(request, cmd)) {
+    const char* shown = cmd.screen == SCREEN_REMINDER ? "reminder"
+                      : (cmd.screen == SCREEN_CALENDAR ? "calendar" : "notifs");
+    request->send(200, "application/json",
+      arenaFormat(requestArena, "{\"status\":\"ok\",\"screen\":\"%s\"}", shown).ptr);
+  }
 }
 
 // ==================== Root Handler ====================
+// Fixed text, served straight from flash
+static const char ROOT_PAGE[] PROGMEM =
+  "<h1>Notification Center</h1>"
+  "<p>Use <b>/addreminder</b> POST to add reminders</p>"
+  "<p>Use <b>/reminders</b> GET to list reminders</p>"
+  "<p>Use <b>/completeReminder?id=...</b> POST to mark done</p>"
+  "<p>Use <b>/screen?name=notifs|reminder|calendar</b> POST to switch</p>"
+  "<p>Use <b>/nowplaying</b> POST with song, artist</p>"
+  "<p>Use <b>/motor</b> POST with speed=0..255</p>"
+  "<p>Use <b>/gaming</b> POST with enabled=0|1</p>"
+  "<p>Use <b>/pcstats</b> POST with cpu_temp, cpu_usage, cpu_speed, ram_used, ram_total, gpu_temp, gpu_usage, net_speed</p>"
+  "<p>Use <b>/calmonth</b> POST with month=1-12, year=YYYY (0 to reset to current)</p>"
+  "<p>Use <b>/icon</b> POST with app, icon=base64 14x14 RGB565 (big-endian)</p>"
+  "<p>Use <b>/icons</b> GET for uploaded icon cache stats</p>"
+  "<p>Use <b>/metrics</b> GET for per-zone render/SPI counters</p>"
+  "<p>Use <b>/frames</b> GET for frame scheduler deadlines</p>"
+  "<p>Use <b>/sprites</b> GET for sprite pool usage</p>"
+  "<p>Use <b>/queue</b> GET for API command queue counters</p>"
+  "<p>Use <b>/tasks</b> GET for per-task CPU use and stack high-water marks</p>"
+  "<p>Use <b>/pcstats</b> GET for the latest PC stats sample and seqlock counters</p>"
+  "<p>Use <b>/power</b> GET for static idle residency and per-core idle time</p>"
+  "<p>Use <b>/heap</b> GET for heap fragmentation history and request arena usage</p>"
+  "<p>Use <b>/history</b> GET for notification history log usage</p>"
+  "<p>Use <b>/notifstats</b> GET for merged vs displayed notification counters</p>"
+  "<p>Use <b>/calcache</b> GET for calendar month cache renders and replays</p>";
+
 void handleRoot(AsyncWebServerRequest* request) {
-  String html = "<h1>Notification Center</h1>";
-  html += "<p>Use <b>/addreminder</b> POST to add reminders</p>";
-  html += "<p>Use <b>/reminders</b> GET to list reminders</p>";
-  html += "<p>Use <b>/completeReminder?id=...</b> POST to mark done</p>";
-  html += "<p>Use <b>/screen?name=notifs|reminder|calendar</b> POST to switch</p>";
-  html += "<p>Use <b>/nowplaying</b> POST with song, artist</p>";
-  html += "<p>Use <b>/motor</b> POST with speed=0..255</p>";
-  html += "<p>Use <b>/gaming</b> POST with enabled=0|1</p>";
-  html += "<p>Use <b>/pcstats</b> POST with cpu_temp, cpu_usage, cpu_speed, ram_used, ram_total, gpu_temp, gpu_usage, net_speed</p>";
-  html += "<p>Use <b>/calmonth</b> POST with month=1-12, year=YYYY (0 to reset to current)</p>";
-  request->send(200, "text/html", html);
+  request->send_P(200, "text/html", ROOT_PAGE);
 }
 
 // ==================== Motor Handler ====================
@@ -301,88 +464,147 @@ void handleMotorSet(AsyncWebServerRequest* request) {
     return;
   }
 
-  String s = request->getParam("speed", true)->value();
-  int val = s.toInt();
+  arenaReset(requestArena);
+  int val = atoi(requestParam(request, "speed", "0").ptr);
   val = constrain(val, 0, 255);
-  setMotorRaw(val);
 
-  String resp = "{\"speed\":" + String(val) + "}";
-  request->send(200, "application/json", resp);
+  Command cmd;
+  cmd.type = CMD_MOTOR;
+  cmd.motorSpeed = val;
+  if (queueCommand(request, cmd)) {
+    request->send(200, "application/json", arenaFormat(requestArena, "{\"speed\":%d}", val).ptr);
+  }
 }
 
 // ==================== Gaming Mode Handler ====================
 void handleGamingMode(AsyncWebServerRequest* request) {
-  String enabled = request->hasParam("enabled", true) ? request->getParam("enabled", true)->value() : "";
+  TextSlice enabled = requestParam(request, "enabled", "");
 
-  if (enabled == "1" || enabled == "true") {
-    gamingMode = true;
-    setZoneDirty(ZONE_STATUS);
+  Command cmd;
+  cmd.type = CMD_GAMING;
+  cmd.gaming = textEquals(enabled, "1") || textEquals(enabled, "true");
+  if (!queueCommand(request, cmd)) {
+    return;
+  }
+
+  if (cmd.gaming) {
     Serial.println("Gaming mode: ON");
     request->send(200, "application/json", "{\"gaming\":true}");
   } else {
-    gamingMode = false;
-    setZoneDirty(ZONE_STATUS);
     Serial.println("Gaming mode: OFF");
     request->send(200, "application/json", "{\"gaming\":false}");
   }
 }
 
 // ==================== PC Stats Handler ====================
+// Parameter for each PcStat (pc_stats.h)
+static const char* PC_STAT_PARAMS[PC_STAT_COUNT] = {
+  "cpu_temp", "cpu_usage", "cpu_speed", "ram_used", "ram_total",
+  "gpu_temp", "gpu_usage", "net_down", "net_up"
+};
+
 void handlePcStats(AsyncWebServerRequest* request) {
   // Always accept stats (display logic decides what to show)
 
-  // Parse all stats from request
-  pcCpuTemp = request->hasParam("cpu_temp", true) ? request->getParam("cpu_temp", true)->value().toInt() : pcCpuTemp;
-  pcCpuUsage = request->hasParam("cpu_usage", true) ? request->getParam("cpu_usage", true)->value().toInt() : pcCpuUsage;
-  pcCpuSpeed = request->hasParam("cpu_speed", true) ? request->getParam("cpu_speed", true)->value().toFloat() : pcCpuSpeed;
-  pcRamUsed = request->hasParam("ram_used", true) ? request->getParam("ram_used", true)->value().toInt() : pcRamUsed;
-  pcRamTotal = request->hasParam("ram_total", true) ? request->getParam("ram_total", true)->value().toInt() : pcRamTotal;
-  pcGpuTemp = request->hasParam("gpu_temp", true) ? request->getParam("gpu_temp", true)->value().toInt() : pcGpuTemp;
-  pcGpuUsage = request->hasParam("gpu_usage", true) ? request->getParam("gpu_usage", true)->value().toInt() : pcGpuUsage;
-  pcNetDown = request->hasParam("net_down", true) ? request->getParam("net_down", true)->value().toFloat() : pcNetDown;
-  pcNetUp = request->hasParam("net_up", true) ? request->getParam("net_up", true)->value().toFloat() : pcNetUp;
+  // Parse all stats from request; missing ones keep their last value
+  float values[PC_STAT_COUNT];
+  for (int i = 0; i < PC_STAT_COUNT; i++) {
+    values[i] = request->hasParam(PC_STAT_PARAMS[i], true)
+                    ? request->getParam(PC_STAT_PARAMS[i], true)->value().toFloat()
+                    : NAN;
+  }
 
-  pcStatsUpdated = millis();
-  setZoneDirty(ZONE_STATUS);
+  // Latest sample wins, so stats skip the command queue; the render task
+  // picks up the new sequence on its next wake
+  publishPcStats(values);
+  wakeRenderTask();
 
+  PcStats s;
+  readPcStats(s);
   Serial.printf("PC Stats: CPU %d°/%d%%/%.1fG GPU %d°/%d%% RAM %d/%dG NET ↓%.1f ↑%.1fM\n",
-                pcCpuTemp, pcCpuUsage, pcCpuSpeed, pcGpuTemp, pcGpuUsage,
-                pcRamUsed, pcRamTotal, pcNetDown, pcNetUp);
+                s.cpuTemp, s.cpuUsage, s.cpuSpeed, s.gpuTemp, s.gpuUsage,
+                s.ramUsed, s.ramTotal, s.netDown, s.netUp);
 
   request->send(200, "application/json", "{\"status\":\"ok\"}");
 }
 
+void handleGetPcStats(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", pcStatsJson());
+}
+
 // ==================== Calendar Month Handler ====================
 void handleCalendarMonth(AsyncWebServerRequest* request) {
-  String monthStr = request->hasParam("month", true) ? request->getParam("month", true)->value() : "";
-  String yearStr = request->hasParam("year", true) ? request->getParam("year", true)->value() : "";
-
-  int month = monthStr.toInt();  // 1-12, 0 = reset
-  int year = yearStr.toInt();    // YYYY, 0 = reset
-
-  if (month == 0 && year == 0) {
-    // Reset to current month/year
-    calViewMonth = -1;
-    calViewYear = 0;
-    Serial.println("Calendar: reset to current month");
-  } else {
-    // Validate and set
-    if (month >= 1 && month <= 12) {
-      calViewMonth = month - 1;  // Convert to 0-11
-    }
-    if (year > 0) {
-      calViewYear = year;
-    }
-    Serial.printf("Calendar: set to %d/%d\n", calViewMonth + 1, calViewYear);
+  arenaReset(requestArena);
+  TextSlice monthStr = requestParam(request, "month", "");
+  TextSlice yearStr = requestParam(request, "year", "");
+
+  Command cmd;
+  cmd.type = CMD_CAL_MONTH;
+  cmd.calMonth.month = atoi(monthStr.ptr);  // 1-12, 0 = reset
+  cmd.calMonth.year = atoi(yearStr.ptr);    // YYYY, 0 = reset
+  if (!queueCommand(request, cmd)) {
+    return;
   }
 
-  // Switch to calendar screen if not already on it
-  if (currentScreen != SCREEN_CALENDAR) {
-    currentScreen = SCREEN_CALENDAR;
-    setZoneDirty(ZONE_TITLE);
-  }
-  setAllContentDirty();
+  // Reply with the month the calendar will show once the command is applied;
+  // fields it leaves alone come from the render task's published view
+  int month = cmd.calMonth.month;
+  int year = cmd.calMonth.year;
+  int viewMonth, viewYear;
+  readCalView(&viewMonth, &viewYear);
+  bool reset = (month == 0 && year == 0);
+  int shownMonth = reset ? 0 : (month >= 1 && month <= 12 ? month : viewMonth + 1);
+  int shownYear = reset ? 0 : (year > 0 ? year : viewYear);
 
   request->send(200, "application/json",
-    "{\"status\":\"ok\",\"month\":" + String(calViewMonth + 1) + ",\"year\":" + String(calViewYear) + "}");
+    arenaFormat(requestArena, "{\"status\":\"ok\",\"month\":%d,\"year\":%d}", shownMonth, shownYear).ptr);
+}
+
+// ==================== Metrics Handler ====================
+void handleMetrics(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", metricsJson());
+}
+
+// ==================== Frame Stats Handler ====================
+void handleFrameStats(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", frameSchedulerJson());
+}
+
+// ==================== Sprite Pool Handler ====================
+void handleSpritePool(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", spritePoolJson());
+}
+
+// ==================== Command Queue Handler ====================
+void handleCommandQueue(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", commandQueueJson());
+}
+
+// ==================== Tasks Handler ====================
+void handleTasks(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", tasksJson());
+}
+
+// ==================== Power Handler ====================
+void handlePower(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", powerJson());
+}
+
+// ==================== Heap Handler ====================
+void handleHeap(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", heapJson());
+}
+
+// ==================== History Handlers ====================
+void handleNotifHistory(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", notifHistoryJson());
+}
+
+void handleNotifStats(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", notifStatsJson());
+}
+
+// ==================== Calendar Cache Handler ====================
+void handleCalendarCache(AsyncWebServerRequest* request) {
+  request->send(200, "application/json", calendarCacheJson());
 }
@@ -19,6 +19,19 @@ void handleScreenSwitch(AsyncWebServerRequest* request);
 void handleMotorSet(AsyncWebServerRequest* request);
 void handleGamingMode(AsyncWebServerRequest* request);
 void handlePcStats(AsyncWebServerRequest* request);
+void handleGetPcStats(AsyncWebServerRequest* request);
 void handleCalendarMonth(AsyncWebServerRequest* request);
+void handleMetrics(AsyncWebServerRequest* request);
+void handleFrameStats(AsyncWebServerRequest* request);
+void handleSpritePool(AsyncWebServerRequest* request);
+void handleUploadIcon(AsyncWebServerRequest* request);
+void handleIconCache(AsyncWebServerRequest* request);
+void handleCommandQueue(AsyncWebServerRequest* request);
+void handleTasks(AsyncWebServerRequest* request);
+void handlePower(AsyncWebServerRequest* request);
+void handleHeap(AsyncWebServerRequest* request);
+void handleNotifHistory(AsyncWebServerRequest* request);
+void handleNotifStats(AsyncWebServerRequest* request);
+void handleCalendarCache(AsyncWebServerRequest* request);
 
 #endif
@@ -0,0 +1,158 @@
+#include "arena.h"
+#include <stdarg.h>
+#include "config.h"
+
+static char requestBuf[REQUEST_ARENA_BYTES];
+Arena requestArena = {"request", requestBuf, REQUEST_ARENA_BYTES, 0, 0, 0, 0};
+
+static const TextSlice EMPTY_TEXT = {"", 0};
+
+// ==================== Arena ====================
+void arenaReset(Arena& arena) {
+  arena.used = 0;
+  arena.resets++;
+}
+
+// Room for len characters plus a terminator, or nullptr
+static char* arenaTake(Arena& arena, size_t len) {
+  if (len + 1 > (size_t)(arena.size - arena.used)) {
+    arena.failures++;
+    return nullptr;
+  }
+  char* p = arena.buf + arena.used;
+  arena.used += len + 1;
+  if (arena.used > arena.highWater) arena.highWater = arena.used;
+  return p;
+}
+
+TextSlice arenaFormat(Arena& arena, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  size_t room = arena.size - arena.used;
+  int len = vsnprintf(arena.buf + arena.used, room, fmt, args);
+  va_end(args);
+  if (len < 0 || (size_t)len >= room) {
+    arena.failures++;
+    return EMPTY_TEXT;
+  }
+  // Already written in place; just claim it
+  TextSlice out = {arenaTake(arena, len), (uint16_t)len};
+  return out;
+}
+
+TextSlice arenaReplace(Arena& arena, TextSlice text, const char* from, const char* to) {
+  int fromLen = strlen(from);
+  int toLen = strlen(to);
+  int hits = 0;
+  for (int i = textFind(text, from); i >= 0; i = textFind(text, from, i + fromLen)) {
+    hits++;
+  }
+  if (hits == 0) {
+    return text;
+  }
+
+  size_t len = text.len + (size_t)hits * (toLen - fromLen);
+  char* out = arenaTake(arena, len);
+  if (out == nullptr) {
+    return EMPTY_TEXT;
+  }
+  char* w = out;
+  int pos = 0;
+  for (int i = textFind(text, from); i >= 0; i = textFind(text, from, pos)) {
+    memcpy(w, text.ptr + pos, i - pos);
+    w += i - pos;
+    memcpy(w, to, toLen);
+    w += toLen;
+    pos = i + fromLen;
+  }
+  memcpy(w, text.ptr + pos, text.len - pos);
+  out[len] = '\0';
+  return {out, (uint16_t)len};
+}
+
+// ==================== Views ====================
+// Longer text is viewed up to the limit, like a cut parameter
+static uint16_t sliceLength(size_t len) {
+  return len > UINT16_MAX ? UINT16_MAX : (uint16_t)len;
+}
+
+TextSlice textSlice(const char* s) {
+  return {s, sliceLength(strlen(s))};
+}
+
+TextSlice textSlice(const String& s) {
+  return {s.c_str(), sliceLength(s.length())};
+}
+
+TextSlice textSub(TextSlice text, int start, int end) {
+  if (end < 0 || end > text.len) end = text.len;
+  if (start < 0) start = 0;
+  if (start > end) start = end;
+  return {text.ptr + start, (uint16_t)(end - start)};
+}
+
+TextSlice textTrim(TextSlice text) {
+  int start = 0;
+  int end = text.len;
+  while (start < end && isspace((unsigned char)text.ptr[start])) start++;
+  while (end > start && isspace((unsigned char)text.ptr[end - 1])) end--;
+  return textSub(text, start, end);
+}
+
+int textFind(TextSlice text, const char* needle, int from) {
+  int n = strlen(needle);
+  if (n == 0) {
+    return -1;
+  }
+  for (int i = max(from, 0); i + n <= text.len; i++) {
+    if (memcmp(text.ptr + i, needle, n) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int textFindLast(TextSlice text, char c) {
+  for (int i = text.len - 1; i >= 0; i--) {
+    if (text.ptr[i] == c) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool textStartsWith(TextSlice text, const char* prefix) {
+  size_t n = strlen(prefix);
+  return n <= text.len && memcmp(text.ptr, prefix, n) == 0;
+}
+
+bool textEquals(TextSlice text, const char* s) {
+  return strlen(s) == text.len && memcmp(text.ptr, s, text.len) == 0;
+}
+
+int textCopy(char* dst, size_t size, TextSlice text) {
+  size_t len = text.len;
+  if (len >= size) {
+    // Don't leave half a multi-byte character at the end
+    len = size - 1;
+    while (len > 0 && ((uint8_t)text.ptr[len] & 0xC0) == 0x80) {
+      len--;
+    }
+  }
+  memcpy(dst, text.ptr, len);
+  dst[len] = '\0';
+  return len;
+}
+
+// ==================== Reporting ====================
+String arenaJson() {
+  const Arena& a = requestArena;
+  String out = "{\"arena\":\"";
+  out += a.name;
+  out += "\",\"size\":" + String(a.size);
+  out += ",\"high_water\":" + String(a.highWater);
+  out += ",\"resets\":" + String(a.resets);
+  out += ",\"failures\":" + String(a.failures);
+  out += "}";
+  return out;
+}
@@ -0,0 +1,62 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <Arduino.h>
+
+/**
+ * Bump arena for short-lived text. A handler resets the request arena on
+ * entry and builds its strings there; nothing is freed one by one and none of
+ * it reaches the global heap, so days of requests leave no holes behind.
+ * When an arena runs out, arenaFormat()/arenaReplace() return empty text and
+ * count a failure; callers treat that like text that was cut.
+ *
+ * A TextSlice is a view: pointer and length. Slices made by the arena are
+ * NUL-terminated; views into other text (textSub, textTrim) may not be, so
+ * print them with "%.*s" and TEXT_ARGS().
+ */
+
+struct TextSlice {
+  const char* ptr;
+  uint16_t len;
+};
+
+#define TEXT_ARGS(s) (int)(s).len, (s).ptr
+
+struct Arena {
+  const char* name;
+  char* buf;
+  uint16_t size;
+  uint16_t used;
+  uint16_t highWater;  // Most bytes in use between two resets
+  uint32_t resets;
+  uint32_t failures;   // Requests that did not fit
+};
+
+extern Arena requestArena;  // AsyncTCP task only (handlers run one at a time)
+
+void arenaReset(Arena& arena);
+
+// printf into the arena
+TextSlice arenaFormat(Arena& arena, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// text with every occurrence of from replaced by to, copied into the arena
+// (text itself when there is none)
+TextSlice arenaReplace(Arena& arena, TextSlice text, const char* from, const char* to);
+
+// ==================== Views ====================
+TextSlice textSlice(const char* s);
+TextSlice textSlice(const String& s);               // Valid while s is unchanged
+TextSlice textSub(TextSlice text, int start, int end = -1);  // end < 0: to the end
+TextSlice textTrim(TextSlice text);                 // Without edge whitespace
+int textFind(TextSlice text, const char* needle, int from = 0);  // -1 if absent
+int textFindLast(TextSlice text, char c);
+bool textStartsWith(TextSlice text, const char* prefix);
+bool textEquals(TextSlice text, const char* s);
+
+// Copy into dst (size bytes, always terminated), cut at a UTF-8 character boundary
+int textCopy(char* dst, size_t size, TextSlice text);
+
+// Arena sizes, high-water marks and failures, served by /heap
+String arenaJson();
+
+#endif
@@ -6,6 +6,8 @@
 // Button state tracking
 static bool lastBtnClearNotifs = HIGH;  // Pull-up means HIGH when not pressed
 static unsigned long lastDebounceTime = 0;
+static unsigned long pressStart = 0;
+static bool holdReported = false;
 
 void initButtons() {
   // GPIO 34-39 are input-only, no internal pull-up
@@ -15,24 +17,47 @@ void initButtons() {
   Serial.println("Buttons initialized");
 }
 
-void checkButtons() {
+ButtonPress pollClearButton() {
   // Read current state (LOW = pressed with pull-up)
   bool currentState = digitalRead(BTN_CLEAR_NOTIFS);
+  ButtonPress press = BUTTON_NONE;
 
   // Debounce: only act if state changed and debounce time passed
   if (currentState != lastBtnClearNotifs) {
     if (millis() - lastDebounceTime > BTN_DEBOUNCE_MS) {
       lastDebounceTime = millis();
 
-      // Button pressed (HIGH -> LOW transition)
       if (currentState == LOW) {
-        Serial.println("Button: Clear Notifications + Switch to Default Screen");
-        clearAllNotifications();
-        currentScreen = DEFAULT_SCREEN;
-        setAllZonesDirty();
+        // Pressed (HIGH -> LOW): short or long is known on release or after the hold time
+        pressStart = millis();
+        holdReported = false;
+      } else if (!holdReported) {
+        press = BUTTON_SHORT;
       }
-
       lastBtnClearNotifs = currentState;
     }
+  } else if (currentState == LOW && !holdReported && millis() - pressStart >= BTN_LONG_PRESS_MS) {
+    holdReported = true;
+    press = BUTTON_LONG;
+  }
+  return press;
+}
+
+void clearButtonPressed() {
+  if (browsingNotifHistory()) {
+    Serial.println("Button: Back to latest notifications");
+    showLatestNotifs();
+    return;
   }
+
+  Serial.println("Button: Clear Notifications + Switch to Default Screen");
+  clearAllNotifications();
+  currentScreen = DEFAULT_SCREEN;
+  setAllZonesDirty();
+}
+
+void clearButtonHeld() {
+  // One page back per hold; after the oldest page, back to the latest
+  pageNotifHistory(1, true);
+  Serial.println("Button: Notification history page");
 }
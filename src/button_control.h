@@ -6,7 +6,24 @@
 // Initialize button pins
 void initButtons();
 
-// Check buttons and handle actions (call in loop)
-void checkButtons();
+enum ButtonPress {
+  BUTTON_NONE,
+  BUTTON_SHORT,  // Released before BTN_LONG_PRESS_MS
+  BUTTON_LONG    // Held for BTN_LONG_PRESS_MS (reported once, while still held)
+};
+
+/**
+ * Debounced press of the clear button (input task, polled).
+ * A short press is reported on release, not on the press edge: the clear it
+ * triggers can't be undone, so it waits until the button is known not to be
+ * the start of a history hold. A long press is reported as soon as the hold
+ * time is reached, and its release reports nothing.
+ */
+ButtonPress pollClearButton();
+
+// Act on a press (render task, which owns the screen state): a short press
+// clears, or leaves history paging; a long press pages history
+void clearButtonPressed();
+void clearButtonHeld();
 
 #endif
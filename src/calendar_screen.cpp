@@ -3,6 +3,9 @@
 #include "config.h"
 #include "screen.h"
 #include "types.h"
+#include "render_metrics.h"
+#include "content_canvas.h"
+#include "seqlock.h"
 #include <time.h>
 #include "fonts/MDIOTrial_Regular9pt7b.h"
 #include "fonts/MDIOTrial_Bold9pt7b.h"
@@ -10,6 +13,142 @@
 
 static const char* DAY_NAMES[] = {"Mo", "Tu", "We", "Th", "Fr", "Sa", "Su"};
 
+static const int CAL_W = 320;
+static const int CAL_H = 195;  // 240 - 45
+
+// ==================== Month Cache ====================
+/**
+ * The last fully rendered month, packed as a palette and runs (the run
+ * bytes of rle_sprite.h) and owned by the calendar. The content canvas is
+ * shared: the other screens draw over it and the sprite pool may free it, so
+ * its tag only saves work while nothing else has used it. Coming back to the
+ * same month fills the background and replays the other runs, with no
+ * layout, glyph lookups or bitmap decoding.
+ */
+static uint16_t cachePalette[16];   // RGB565; entry 0 is always the background
+static int cacheColors = 0;
+static uint16_t cacheRows[CAL_H];   // Offset of each row's runs in cacheData
+static uint8_t cacheData[CAL_CACHE_BYTES];
+static uint32_t cacheTag = 0;       // Month tag of the packed render, 0 = none
+
+// Month cache counters
+static uint32_t cacheRenders = 0;   // Months laid out and drawn
+static uint32_t cacheReplays = 0;   // Months replayed from the runs
+static uint32_t cacheOverflows = 0; // Renders too busy to pack into CAL_CACHE_BYTES
+
+// The counters as /calcache serves them, published by the render task after
+// each render or replay
+struct CalendarCacheReport {
+  uint32_t renders;
+  uint32_t replays;
+  uint32_t overflows;
+  uint32_t cached;
+};
+static Seqlock<CalendarCacheReport> report;
+
+static void publishCacheReport() {
+  CalendarCacheReport r = {cacheRenders, cacheReplays, cacheOverflows, cacheTag != 0};
+  report.publish(r);
+}
+
+// Append one run; false if the buffer is full
+static bool packRun(int* used, int index, int len) {
+  while (len > 0) {
+    int n = min(len, 16 + 255);
+    int bytes = (n >= 16) ? 2 : 1;
+    if (*used + bytes > CAL_CACHE_BYTES) {
+      return false;
+    }
+    if (n >= 16) {
+      cacheData[(*used)++] = (uint8_t)((index << 4) | 0x0F);
+      cacheData[(*used)++] = (uint8_t)(n - 16);
+    } else {
+      cacheData[(*used)++] = (uint8_t)((index << 4) | (n - 1));
+    }
+    len -= n;
+  }
+  return true;
+}
+
+// Pack the month just drawn on the full canvas, rows from canvas y
+static void packMonth(int y, uint32_t tag) {
+  cacheTag = 0;
+  cachePalette[0] = COLOR_BACKGROUND;
+  int colors = 1;
+  int used = 0;
+  int lastLen = 0;  // Bytes of the row at cacheRows[row - 1]
+  for (int row = 0; row < CAL_H; row++) {
+    int start = used;
+    int runIndex = -1;
+    int runLen = 0;
+    for (int x = 0; x <= CAL_W; x++) {
+      int index = -1;
+      if (x < CAL_W) {
+        uint16_t c = contentColorAt(x, y + row);
+        for (index = 0; index < colors && cachePalette[index] != c; index++) {
+        }
+        if (index == colors) {
+          if (colors == 16) {
+            cacheOverflows++;
+            return;
+          }
+          cachePalette[colors++] = c;
+        }
+      }
+      if (index == runIndex) {
+        runLen++;
+        continue;
+      }
+      if (runLen > 0 && !packRun(&used, runIndex, runLen)) {
+        cacheOverflows++;
+        return;
+      }
+      runIndex = index;
+      runLen = 1;
+    }
+    // A row the same as the one above is stored once
+    if (row > 0 && used - start == lastLen &&
+        memcmp(cacheData + start, cacheData + cacheRows[row - 1], lastLen) == 0) {
+      used = start;
+      cacheRows[row] = cacheRows[row - 1];
+    } else {
+      cacheRows[row] = start;
+      lastLen = used - start;
+    }
+  }
+  cacheColors = colors;
+  cacheTag = tag;
+}
+
+// Draw the packed month with its top-left at canvas (0, y)
+static void replayMonth(TFT_eSPI& canvas, int y) {
+  canvas.fillRect(0, y, CAL_W, CAL_H, contentInk(COLOR_BACKGROUND));
+  uint16_t inks[16];
+  for (int i = 0; i < cacheColors; i++) {
+    inks[i] = contentInk(cachePalette[i]);
+  }
+
+  int vpY = canvas.getViewportY();
+  int first = max(0, vpY - y);
+  int last = min(CAL_H, vpY + (int)canvas.getViewportHeight() - y);
+  for (int row = first; row < last; row++) {
+    const uint8_t* p = cacheData + cacheRows[row];
+    int col = 0;
+    while (col < CAL_W) {
+      uint8_t run = *p++;
+      int len = (run & 0x0F) + 1;
+      if (len == 16) {
+        len += *p++;
+      }
+      int index = run >> 4;
+      if (index != 0) {
+        canvas.drawFastHLine(col, y + row, len, inks[index]);
+      }
+      col += len;
+    }
+  }
+}
+
 // ==================== Helper: Get Days in Month ====================
 int getDaysInMonth(int month, int year) {
   if (month == 1) { // February
@@ -20,39 +159,12 @@ int getDaysInMonth(int month, int year) {
   return 31;
 }
 
-static TFT_eSprite calSprite = TFT_eSprite(&tft);
-static bool calSpriteCreated = false;
-static bool calSpriteAttempted = false;
-
 // ==================== Draw Content ====================
 void drawCalendarContent() {
-  // Use a sprite for the entire content zone (320x195) to eliminate flicker
-  static const int calW = 320;
-  static const int calH = 195; // 240 - 45 = 195
   const int zoneY = 45;
 
-  if (!calSpriteAttempted) {
-    calSpriteAttempted = true;
-    calSprite.setColorDepth(8); // Use 8-bit color to save RAM (~62KB)
-    void* ptr = calSprite.createSprite(calW, calH);
-    if (ptr == nullptr) {
-      Serial.println("CRITICAL: Failed to create calendar sprite (even at 8-bit). Falling back to direct drawing.");
-      calSpriteCreated = false;
-    } else {
-      Serial.printf("SUCCESS: Calendar sprite (8-bit) created at %p\n", ptr);
-      calSpriteCreated = true;
-    }
-  }
-
-  // Define drawing surface
-  TFT_eSPI &canvas = calSpriteCreated ? (TFT_eSPI &)calSprite : tft;
-  int yOffset = calSpriteCreated ? 0 : zoneY;
-
-  if (calSpriteCreated) {
-    calSprite.fillSprite(COLOR_BACKGROUND);
-  } else {
-    tft.fillRect(0, zoneY, calW, calH, COLOR_BACKGROUND);
-  }
+  TFT_eSPI &canvas = contentCanvas();
+  int yOffset = zoneY - contentOriginY();
 
   time_t now = time(nullptr);
   struct tm tm;
@@ -78,6 +190,30 @@ void drawCalendarContent() {
 
   // Check if we're viewing the current month (for highlighting today)
   bool isCurrentMonth = (displayMonth == todayMonth && displayYear == todayYear);
+  int highlightDay = isCurrentMonth ? todayDay : 0;
+
+  // Same month already on the canvas: the damage is pushed from it as it is
+  uint32_t monthTag = ((uint32_t)(displayYear * 12 + displayMonth) << 5) | highlightDay;
+  if (contentCanvasActive() && reuseContentCanvas(monthTag)) {
+    return;
+  }
+
+  // Another screen used the canvas since: replay the packed month
+  if (cacheTag == monthTag) {
+    replayMonth(canvas, yOffset);
+    contentRecordPush(0, yOffset, CAL_W, CAL_H);
+    cacheReplays++;
+    if (contentCanvasActive()) {
+      setContentCanvasTag(contentCanvasFull() ? monthTag : 0);
+    }
+    publishCacheReport();
+    return;
+  }
+  cacheRenders++;
+
+  // The calendar paints every content pixel (no zone background)
+  canvas.fillRect(0, yOffset, CAL_W, CAL_H, contentInk(COLOR_BACKGROUND));
+  contentRecordPush(0, yOffset, CAL_W, CAL_H);
 
   // Calculate first day of displayed month
   struct tm firstDayTm = {0};
@@ -91,7 +227,7 @@ void drawCalendarContent() {
 
   // Render Day Headers (Mo Tu We Th...)
   canvas.setFreeFont(&MDIOTrial_Regular9pt7b);
-  canvas.setTextColor(COLOR_CAL_DAY_HEADER);
+  canvas.setTextColor(contentInk(COLOR_CAL_DAY_HEADER));
   for (int i = 0; i < 7; i++) {
     int x = CAL_X_START + (i * CAL_COL_W) + CAL_TEXT_X_OFFSET;
     int y = yOffset + CAL_Y_HEADER + CAL_TEXT_Y_OFFSET;
@@ -103,6 +239,7 @@ void drawCalendarContent() {
 
   // Render Dates
   canvas.setFreeFont(&MDIOTrial_Regular9pt7b);
+  char dayBuf[12];
   for (int d = 1; d <= daysInMonth; d++) {
     int col = (d + startOffset - 1) % 7;
     int row = (d + startOffset - 1) / 7;
@@ -110,34 +247,48 @@ void drawCalendarContent() {
     int x = CAL_X_START + (col * CAL_COL_W) + CAL_TEXT_X_OFFSET;
     int y = lineY + CAL_GRID_Y_OFFSET + (row * CAL_ROW_H) + CAL_TEXT_Y_OFFSET;
 
+    snprintf(dayBuf, sizeof(dayBuf), "%d", d);
     // Highlight today only if viewing current month
-    if (isCurrentMonth && d == todayDay) {
-      canvas.setTextColor(COLOR_CAL_TODAY_TEXT);
-      canvas.fillRoundRect(x + CAL_HL_X_OFF, y + CAL_HL_Y_OFF, CAL_HL_W, CAL_HL_H, CAL_HL_ROUND, COLOR_CAL_TODAY_BG);
-      canvas.drawString(String(d), x, y);
+    if (d == highlightDay) {
+      canvas.setTextColor(contentInk(COLOR_CAL_TODAY_TEXT));
+      canvas.fillRoundRect(x + CAL_HL_X_OFF, y + CAL_HL_Y_OFF, CAL_HL_W, CAL_HL_H, CAL_HL_ROUND,
+                           contentInk(COLOR_CAL_TODAY_BG));
+      canvas.drawString(dayBuf, x, y);
     } else {
-      canvas.setTextColor(COLOR_CAL_DATE);
-      canvas.drawString(String(d), x, y);
+      canvas.setTextColor(contentInk(COLOR_CAL_DATE));
+      canvas.drawString(dayBuf, x, y);
     }
   }
 
   // Draw month/year at the top left
   canvas.setFreeFont(&MDIOTrial_Bold10pt7b);
-  canvas.setTextColor(COLOR_CAL_TITLE);
+  canvas.setTextColor(contentInk(COLOR_CAL_TITLE));
   char monthBuf[32];
-  // Use the displayed month/year for the title
-  struct tm titleTm = {0};
-  titleTm.tm_year = displayYear - 1900;
-  titleTm.tm_mon = displayMonth;
-  titleTm.tm_mday = 1;
-  mktime(&titleTm);
-  strftime(monthBuf, sizeof(monthBuf), "%B %Y", &titleTm);
+  // Use the displayed month/year for the title (firstDayTm is already normalised)
+  strftime(monthBuf, sizeof(monthBuf), "%B %Y", &firstDayTm);
   // Title remains at fixed title pos, adjusted for content offset if in sprite
   int titleY = yOffset + (CAL_TITLE_Y - zoneY);
   canvas.drawString(monthBuf, CAL_TITLE_X, titleY);
 
-  // Push to screen if using sprite
-  if (calSpriteCreated) {
-    calSprite.pushSprite(0, zoneY);
+  // A full render can be reused until the month or highlighted day changes
+  if (contentCanvasActive()) {
+    setContentCanvasTag(contentCanvasFull() ? monthTag : 0);
+    if (contentCanvasFull()) {
+      packMonth(yOffset, monthTag);
+    }
   }
+  publishCacheReport();
+}
+
+// ==================== Reporting ====================
+String calendarCacheJson() {
+  CalendarCacheReport r;
+  report.read(r);
+
+  String out = "{\"renders\":" + String(r.renders);
+  out += ",\"replays\":" + String(r.replays);
+  out += ",\"overflows\":" + String(r.overflows);
+  out += ",\"cached\":" + String(r.cached ? "true" : "false");
+  out += "}";
+  return out;
 }
@@ -6,7 +6,15 @@
 /**
  * Draws the calendar content in the content zone.
  * Renders a monthly grid with day headers and highlights the current date.
+ * Paints every content pixel itself, so the zones need no background first.
+ * On the content canvas the rendered month is kept and only redrawn when the
+ * month, year or highlighted day changes. The calendar also keeps its own
+ * packed copy of that render, so coming back after another screen has used
+ * the canvas replays it instead of laying the month out again.
  */
 void drawCalendarContent();
 
+// Month renders, replays from the packed copy and pack overflows, served by GET /calcache
+String calendarCacheJson();
+
 #endif
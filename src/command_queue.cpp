@@ -0,0 +1,211 @@
+#include "command_queue.h"
+#include <atomic>
+#include "config.h"
+#include "screen.h"
+#include "notif_screen.h"
+#include "reminder_screen.h"
+#include "motor_control.h"
+#include "icon_cache.h"
+#include "power.h"
+#include "tasks.h"
+
+static_assert((COMMAND_QUEUE_DEPTH & (COMMAND_QUEUE_DEPTH - 1)) == 0,
+              "COMMAND_QUEUE_DEPTH must be a power of two");
+static_assert(ICON_CACHE_BYTES <= COMMAND_BLOB_BYTES, "icon must fit the command blob");
+
+static Command ring[COMMAND_QUEUE_DEPTH];
+static std::atomic<uint32_t> head(0);  // Next slot to write; only pushCommand() stores it
+static std::atomic<uint32_t> tail(0);  // Next slot to apply; only popCommand() stores it
+
+static uint8_t blob[COMMAND_BLOB_BYTES];
+static std::atomic<bool> blobTaken(false);
+
+// Counters (each written by one side only)
+static uint32_t pushed = 0;
+static uint32_t dropped = 0;    // Queue full
+static uint32_t blobBusy = 0;   // Blob still held by an unapplied command
+static uint32_t highWater = 0;  // Deepest the queue has been
+static uint32_t applied = 0;
+
+// ==================== Producer ====================
+bool pushCommand(const Command& cmd) {
+  uint32_t h = head.load(std::memory_order_relaxed);
+  uint32_t depth = h - tail.load(std::memory_order_acquire);
+  if (depth >= COMMAND_QUEUE_DEPTH) {
+    dropped++;
+    return false;
+  }
+  ring[h & (COMMAND_QUEUE_DEPTH - 1)] = cmd;
+  head.store(h + 1, std::memory_order_release);
+
+  pushed++;
+  if (depth + 1 > highWater) highWater = depth + 1;
+  wakeRenderTask();
+  return true;
+}
+
+uint8_t* acquireCommandBlob() {
+  if (blobTaken.exchange(true, std::memory_order_acquire)) {
+    blobBusy++;
+    return nullptr;
+  }
+  return blob;
+}
+
+void releaseCommandBlob() {
+  blobTaken.store(false, std::memory_order_release);
+}
+
+// ==================== Apply ====================
+static void applyNowPlaying(const Command& cmd) {
+  if (cmd.nowPlaying.song[0] == '\0') {
+    // Clear now playing (but preserve disc frame state)
+    nowPlayingSong = "";
+    nowPlayingArtist = "";
+    nowPlayingActive = false;
+    nowPlayingScrollPixel = 0;
+    albumArtValid = false;
+    invalidateNowPlayingStrip();
+    setZoneDirty(ZONE_STATUS);
+    return;
+  }
+
+  // New song - start scroll from right edge
+  nowPlayingSong = cmd.nowPlaying.song;
+  nowPlayingArtist = cmd.nowPlaying.artist;
+  nowPlayingUpdated = millis();
+  nowPlayingScrollPixel = -320;
+  lastScrollUpdate = millis();
+  lastDiscUpdate = millis();
+  nowPlayingActive = true;
+  invalidateNowPlayingStrip();  // Re-render the ticker text once
+
+  albumArtValid = cmd.nowPlaying.artWidth > 0;
+  if (albumArtValid) {
+    albumArtWidth = cmd.nowPlaying.artWidth;
+    albumArtHeight = ALBUM_ART_SIZE;
+    memcpy(albumArt, blob, albumArtWidth * albumArtHeight * 2);
+    releaseCommandBlob();
+  }
+  setZoneDirty(ZONE_STATUS);  // Album art displays in status zone
+}
+
+static void applyCalendarMonth(const Command& cmd) {
+  int month = cmd.calMonth.month;
+  int year = cmd.calMonth.year;
+  if (month == 0 && year == 0) {
+    // Reset to current month/year
+    calViewMonth = -1;
+    calViewYear = 0;
+    Serial.println("Calendar: reset to current month");
+  } else {
+    // Validate and set
+    if (month >= 1 && month <= 12) {
+      calViewMonth = month - 1;  // Convert to 0-11
+    }
+    if (year > 0) {
+      calViewYear = year;
+    }
+    Serial.printf("Calendar: set to %d/%d\n", calViewMonth + 1, calViewYear);
+  }
+  publishCalView();
+
+  // Switch to calendar screen if not already on it
+  if (currentScreen != SCREEN_CALENDAR) {
+    currentScreen = SCREEN_CALENDAR;
+    setZoneDirty(ZONE_TITLE);
+  }
+  setAllContentDirty();
+}
+
+static void applyCommand(const Command& cmd) {
+  switch (cmd.type) {
+    case CMD_NOTIFY:
+      addNotification(cmd.notify.app, cmd.notify.from, cmd.notify.message, cmd.notify.color);
+      break;
+    case CMD_CLEAR_NOTIFS:
+      clearAllNotifications();
+      break;
+    case CMD_ADD_REMINDER:
+      if (addReminder(cmd.reminder.id, cmd.reminder.message, cmd.reminder.when,
+                      cmd.reminder.limitMins, cmd.reminder.color) == -1) {
+        Serial.printf("Reminder %d dropped: max reminders reached\n", cmd.reminder.id);
+      }
+      break;
+    case CMD_COMPLETE_REMINDER:
+      completeReminder(cmd.complete.id);
+      break;
+    case CMD_NOW_PLAYING:
+      applyNowPlaying(cmd);
+      break;
+    case CMD_SHOW_SCREEN:
+      currentScreen = cmd.screen;
+      setZoneDirty(ZONE_TITLE);
+      setAllContentDirty();
+      break;
+    case CMD_MOTOR:
+      setMotorRaw(cmd.motorSpeed);
+      break;
+    case CMD_GAMING:
+      gamingMode = cmd.gaming;
+      setZoneDirty(ZONE_STATUS);
+      break;
+    case CMD_CAL_MONTH:
+      applyCalendarMonth(cmd);
+      break;
+    case CMD_STORE_ICON: {
+      // Already on flash (saved by the handler); only RAM and the screen change here
+      uint32_t key = cacheAppIcon(cmd.icon.app, blob);
+      releaseCommandBlob();
+      if (key != 0) {
+        refreshNotificationIcons(key);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+// ==================== Consumer ====================
+bool popCommand(Command& out) {
+  uint32_t t = tail.load(std::memory_order_relaxed);
+  if (t == head.load(std::memory_order_acquire)) {
+    return false;
+  }
+  out = ring[t & (COMMAND_QUEUE_DEPTH - 1)];
+  tail.store(t + 1, std::memory_order_release);  // Slot is free once copied out
+  applied++;
+  return true;
+}
+
+void drainCommandQueue() {
+  // Commands pushed after this snapshot wait for the next frame
+  uint32_t pending = head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+  if (pending > 0) {
+    noteActivity();
+  }
+  Command cmd;
+  while (pending-- > 0 && popCommand(cmd)) {
+    applyCommand(cmd);
+  }
+}
+
+bool commandsQueued() {
+  return head.load(std::memory_order_acquire) != tail.load(std::memory_order_relaxed);
+}
+
+// ==================== Reporting ====================
+String commandQueueJson() {
+  uint32_t h = head.load(std::memory_order_acquire);
+  uint32_t t = tail.load(std::memory_order_acquire);
+  String out = "{\"depth\":" + String(COMMAND_QUEUE_DEPTH);
+  out += ",\"queued\":" + String(h - t);
+  out += ",\"pushed\":" + String(pushed);
+  out += ",\"applied\":" + String(applied);
+  out += ",\"dropped\":" + String(dropped);
+  out += ",\"blob_busy\":" + String(blobBusy);
+  out += ",\"high_water\":" + String(highWater);
+  out += "}";
+  return out;
+}
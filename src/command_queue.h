@@ -0,0 +1,101 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include "state.h"
+
+/**
+ * API handlers run on the AsyncTCP task, while loop() reads the screen state
+ * to render it. Handlers therefore never change that state themselves: they
+ * parse the request into a Command and push it here, and the frame scheduler
+ * applies the queued commands on the loop task at the start of each frame.
+ *
+ * One producer (the AsyncTCP task), one consumer (loop). The ring is
+ * lock-free: each side owns one index and publishes it with release ordering.
+ * Text is copied into the command, so nothing is shared with the handler once
+ * it is pushed. Album art and icon pixels are too big for a slot and travel
+ * in the command blob instead, which is free again once the command carrying
+ * it has been applied.
+ */
+
+static const int COMMAND_BLOB_BYTES = ALBUM_ART_MAX_PIXELS * 2;  // Largest album art; icons fit too
+
+enum CommandType : uint8_t {
+  CMD_NOTIFY,
+  CMD_CLEAR_NOTIFS,
+  CMD_ADD_REMINDER,
+  CMD_COMPLETE_REMINDER,
+  CMD_NOW_PLAYING,      // Empty song clears now playing
+  CMD_SHOW_SCREEN,
+  CMD_MOTOR,
+  CMD_GAMING,
+  CMD_CAL_MONTH,
+  CMD_STORE_ICON,       // Pixels in the blob, already saved to flash
+  CMD_TYPE_COUNT
+};
+
+struct Command {
+  CommandType type;
+  union {
+    struct {
+      char app[NOTIF_APP_MAX_CHARS + 1];
+      char from[NOTIF_SENDER_MAX_CHARS + 1];
+      char message[NOTIF_MSG_MAX_CHARS + 1];
+      uint16_t color;
+    } notify;
+    struct {
+      int id;  // Reserved by the handler, so it can reply with it
+      time_t when;
+      int limitMins;
+      uint16_t color;
+      char message[COMMAND_TEXT_CHARS];
+    } reminder;
+    struct {
+      int id;
+    } complete;
+    struct {
+      char song[COMMAND_TEXT_CHARS];
+      char artist[COMMAND_TEXT_CHARS];
+      int16_t artWidth;  // Album art in the blob (ALBUM_ART_SIZE rows), 0 = none
+    } nowPlaying;
+    Screen screen;
+    int motorSpeed;
+    bool gaming;
+    struct {
+      int month;  // 1-12, both 0 = back to the current month
+      int year;
+    } calMonth;
+    struct {
+      char app[NOTIF_APP_MAX_CHARS + 1];
+    } icon;
+  };
+};
+
+// Queue a command and wake the render task (AsyncTCP task only); false if the queue is full
+bool pushCommand(const Command& cmd);
+
+// Apply every queued command (loop task, once per frame)
+void drainCommandQueue();
+
+/**
+ * Take the oldest command without applying it (consumer side only; what
+ * drainCommandQueue() is built on). A blob it carries stays held until the
+ * caller releases it.
+ * @return false if the queue is empty
+ */
+bool popCommand(Command& out);
+
+// True while commands wait for the next frame
+bool commandsQueued();
+
+/**
+ * Take the COMMAND_BLOB_BYTES staging buffer for a command's bulk data.
+ * @return nullptr while an earlier command still holds it
+ */
+uint8_t* acquireCommandBlob();
+void releaseCommandBlob();  // For a handler that gives up before pushing
+
+// Pushed, applied, dropped and high-water counters, served by /queue
+String commandQueueJson();
+
+#endif
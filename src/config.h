@@ -11,6 +11,7 @@
 // Debugging
 #define DEBUG_SHOW_ZONES 0
 #define SPRITE_BG_ENABLED 1  // Set to 1 to enable sprite backgrounds, 0 for solid fill
+#define RLE_BLOCK_LINES 4    // Background rows decoded per pushImage (320 px = 640 bytes each)
 
 // Default screen on startup (SCREEN_NOTIFS, SCREEN_REMINDER, SCREEN_CALENDAR)
 #define DEFAULT_SCREEN SCREEN_CALENDAR
@@ -53,6 +54,9 @@
 #define ZONE_CONTENT3_Y_START 175
 #define ZONE_CONTENT3_Y_END 239
 
+// Damage tracking: rects kept per zone before the closest pair is merged
+#define MAX_DAMAGE_RECTS 4
+
 // Motor driver pins (L298N Motor A) - Left side only
 #define MOTOR_ENA 33   // PWM speed control
 #define MOTOR_IN1 13   // Direction (always HIGH for forward)
@@ -64,31 +68,37 @@
 #define MOTOR_PWM_RES     8      // 8-bit = 0-255
 
 // Button pins (input-only GPIOs, external pull-up required)
-#define BTN_CLEAR_NOTIFS  35     // Clear all notifications
+#define BTN_CLEAR_NOTIFS  35     // Clear all notifications (hold: page history)
 #define BTN_DEBOUNCE_MS   50     // Debounce delay in ms
+#define BTN_LONG_PRESS_MS 600    // Holding the clear button this long pages notification history
 
 // Rotary encoder pins (input-only GPIOs, external pull-up required)
 #define ENCODER_ENABLED   0      // Set to 1 when encoder is wired
 #define ENCODER_CLK       36     // Rotation signal A
 #define ENCODER_DT        39     // Rotation signal B
 #define ENCODER_SW        34     // Push button
-#define ENCODER_SPEED_STEP 15    // Speed change per click
+#define ENCODER_SPEED_STEP 15    // Speed change per click (off the notification screen, which it pages)
 #define ENCODER_MIN_SPEED  50    // Minimum motor speed
 
 // ===== Icon Dimensions =====
 #define ICON_HEIGHT 14
 #define ICON_WIDTH 14
 #define REMINDER_ICON_RADIUS 7
+#define DISC_RADIUS 7          // Spinning disc outer circle radius
+#define DISC_INNER_RADIUS 2    // Spinning disc hub radius
+#define DISC_FRAMES 64         // Rotation frames (5.625 degrees apart)
 
 // ===== Display Limits =====
 #define MAX_NOTIFICATIONS 5
 #define MAX_REMINDERS 50
 
 // ===== Text Truncation Limits =====
-#define NOTIF_SENDER_MAX_CHARS 24
-#define NOTIF_MSG_MAX_CHARS 68
-#define NOTIF_MSG_LINE_CHARS 35
-#define REMINDER_MSG_MAX_CHARS 68
+#define NOTIF_MSG_MAX_CHARS 68     // Stored message length
+#define NOTIF_APP_MAX_CHARS 31     // Stored app name length (the icon lookup uses no more)
+#define NOTIF_SENDER_MAX_CHARS 47  // Stored sender length
+#define NOTIF_SENDER_MAX_W 240     // Sender name width in px (before the ":")
+#define CONTENT_TEXT_MAX_W 310     // Message line width in px (x=5 to a 5px right margin)
+#define CONTENT_TEXT_LINES 2       // Message lines per slot; overflow ends in "..."
 
 // ===== Timing (milliseconds) =====
 #define CLOCK_UPDATE_INTERVAL 1000
@@ -96,6 +106,52 @@
 #define WIFI_CHECK_INTERVAL 30000
 #define WIFI_PORTAL_TIMEOUT 1800
 
+// ===== Notification History =====
+#define NOTIF_HISTORY_BYTES 16384           // Packed log of past notifications (about 200 at typical lengths)
+#define NOTIF_HISTORY_MAX_ENTRIES 512       // Records indexed; the oldest go when either limit is reached
+#define NOTIF_HISTORY_PAGE_TIMEOUT_MS 30000 // Paging returns to the newest after this long without input
+
+// ===== Notification Coalescing =====
+#define NOTIF_COALESCE_WINDOW_MS 10000  // Same app and sender within this long of the last one merge into it (0 = never)
+#define NOTIF_RENDER_DEBOUNCE_MS 150    // Notification screen repaints after this long without another arrival
+#define NOTIF_RENDER_MAX_HOLD_MS 500    // ...or this long after the first of a burst, whichever is sooner
+
+// ===== Sprite Pool =====
+#define SPRITE_POOL_SLOTS 6         // Sprites that can be leased at once (zones + scratch)
+#define SPRITE_POOL_IDLE_MS 2000    // Free a returned sprite's buffer after this long unused
+
+// ===== Icon Cache =====
+#define ICON_CACHE_DIR "/icons"     // Uploaded app icons on LittleFS
+#define ICON_CACHE_RAM_SLOTS 8      // Icons held in RAM (424 bytes each)
+
+// ===== Command Queue =====
+#define COMMAND_QUEUE_DEPTH 16      // API commands waiting for the loop (power of two)
+#define COMMAND_TEXT_CHARS 96       // Reminder / song / artist text per command, with terminator
+
+// ===== Memory =====
+#define REQUEST_ARENA_BYTES 1024       // Scratch text per API request (parameter rewrites, replies)
+#define HEAP_SAMPLE_INTERVAL_MS 60000  // Heap history sample period
+#define HEAP_HISTORY_SAMPLES 60        // Samples kept for /heap (an hour at the default period)
+
+// ===== Tasks =====
+#define RENDER_TASK_PERIOD_MS 1000     // Longest render task sleep; frames, animation and events wake it sooner
+#define INPUT_TASK_PERIOD_MS 2         // Button / encoder polling
+#define SCHEDULER_TASK_PERIOD_MS 1000  // Reminder checks
+#define NETWORK_TASK_PERIOD_MS 1000    // WiFi reconnect checks (every WIFI_CHECK_INTERVAL), heap samples
+#define TASK_EVENT_QUEUE_DEPTH 16      // Input / scheduler events waiting for the render task
+
+// ===== Power =====
+#define STATIC_IDLE_AFTER_MS 60000     // Idle screen with no input or API command this long stops the disc (0 = never)
+#define STATIC_IDLE_LIGHT_SLEEP 1      // While static: WiFi modem sleep, plus light sleep if the PM build allows it
+#define STATIC_IDLE_CPU_MHZ 80         // While static, when light sleep is unavailable
+#define STATIC_IDLE_INPUT_PERIOD_MS 20 // Button / encoder polling while static
+
+// ===== Frame Scheduler =====
+#define FRAME_PERIOD_MS 50          // Frame clock: 20 FPS, the ticker rate
+#define FRAME_BUDGET_US 30000       // Draw time per frame before title/content are deferred
+#define CLOCK_DEADLINE_MS 250       // Clock may draw this late after its tick
+#define CONTENT_DEADLINE_MS 250     // Title/content may be deferred this long after damage (or a notification hold)
+
 // ===== Now Playing Configuration =====
 #define NOW_PLAYING_SCROLL_SPEED 50    // ms between scroll steps (20 FPS)
 #define NOW_PLAYING_SCROLL_STEP 1      // pixels to scroll per step
@@ -133,6 +189,17 @@
 #define CAL_HL_X_OFF -2        // X offset for highlight box alignment
 #define CAL_HL_Y_OFF -4        // Y offset for highlight box alignment
 #define CAL_HL_ROUND 4         // Corner radius of the highlight box
+#define CAL_CACHE_BYTES 4096   // Packed runs of the last rendered month (calendar_screen.cpp)
+
+// ===== Render Metrics =====
+#define RENDER_METRICS_ENABLED 1       // Count pixels/SPI bytes/time per zone and draw function
+#define RENDER_METRICS_SERIAL 0        // Set to 1 to print a metrics table every window
+#define RENDER_METRICS_WINDOW_MS 10000 // Rolling window length for /metrics and serial output
+#define SPI_WINDOW_OVERHEAD_BYTES 11   // CASET + RASET + RAMWR command/parameter bytes per push
+
+// ===== Display DMA =====
+#define DISPLAY_DMA_ENABLED 1   // Push zone sprites with SPI DMA (0 = blocking pushSprite)
+#define DMA_STRIPE_LINES 10     // Lines per DMA stripe; two 320-px stripes = 12.8KB
 
 // ===== NTP Configuration =====
 #define NTP_TIMEZONE_OFFSET (5.5 * 3600)  // IST +5:30
@@ -180,6 +247,10 @@
 // App icon colors
 #define COLOR_WHATSAPP TFT_GREEN
 #define COLOR_TELEGRAM TFT_BLUE
+#define COLOR_TEAMS 0x6334      // #6264A7
+#define COLOR_OUTLOOK 0x03DA    // #0078D4
+#define COLOR_PAGERDUTY 0x0567  // #06AC38
+#define COLOR_DISCORD 0x5B3E    // #5865F2
 #define COLOR_ICON_DEFAULT TFT_DARKGREY
 #define COLOR_ICON_BORDER TFT_WHITE
 
@@ -0,0 +1,187 @@
+#include "content_canvas.h"
+#include "config.h"
+#include "screen.h"
+#include "display_dma.h"
+#include "render_metrics.h"
+#include "sprite_pool.h"
+
+static const int CANVAS_X = ZONE_CONTENT1_X_START;
+static const int CANVAS_Y = ZONE_CONTENT1_Y_START;
+static const int CANVAS_W = ZONE_CONTENT3_X_END - ZONE_CONTENT1_X_START + 1;  // 320
+static const int CANVAS_H = ZONE_CONTENT3_Y_END - ZONE_CONTENT1_Y_START + 1;  // 195
+static const int MAX_OVERLAYS = 4;  // One icon per visible slot, plus a spare
+
+static TFT_eSprite* canvas = nullptr;  // Leased between begin and end
+static DamageRect pushRects[3 * MAX_DAMAGE_RECTS];
+static int pushCount = 0;
+static bool fullArea = false;
+
+static uint16_t palette[16];
+static uint8_t paletteSize = 0;
+static bool paletteFullLogged = false;
+
+static DmaOverlay overlays[MAX_OVERLAYS];
+static int overlayCount = 0;
+
+static uint32_t canvasTag = 0;
+static uint16_t tagPalette[16];  // Palette the tagged render was drawn with
+static uint8_t tagPaletteSize = 0;
+
+// ==================== Begin / End ====================
+bool beginContentCanvas(const DamageRect* rects, int count, bool* intact) {
+  *intact = false;
+  if (count == 0) {
+    return false;
+  }
+  canvas = leaseSprite(SPRITE_OWNER_CONTENT, CANVAS_W, CANVAS_H, 4, intact);
+  if (canvas == nullptr) {
+    canvasTag = 0;
+    return false;
+  }
+
+  // Viewport = bounding box of the damage, in canvas coordinates
+  int x0 = rects[0].x, y0 = rects[0].y;
+  int x1 = x0 + rects[0].w, y1 = y0 + rects[0].h;
+  pushCount = 0;
+  for (int i = 0; i < count; i++) {
+    const DamageRect& r = rects[i];
+    x0 = min(x0, (int)r.x);
+    y0 = min(y0, (int)r.y);
+    x1 = max(x1, r.x + r.w);
+    y1 = max(y1, r.y + r.h);
+    pushRects[pushCount++] = r;
+  }
+  canvas->setViewport(x0 - CANVAS_X, y0 - CANVAS_Y, x1 - x0, y1 - y0, false);
+  fullArea = (x0 <= CANVAS_X && y0 <= CANVAS_Y &&
+              x1 >= CANVAS_X + CANVAS_W && y1 >= CANVAS_Y + CANVAS_H);
+
+  // Pixels outside the damage keep their old indices unless all of them are redrawn
+  if (!*intact || fullArea) {
+    paletteSize = 0;
+  }
+  if (!*intact) {
+    canvasTag = 0;
+  }
+  canvas->setTextSize(1);
+  overlayCount = 0;
+  return true;
+}
+
+void endContentCanvas() {
+  if (canvas == nullptr) {
+    return;
+  }
+  canvas->createPalette(palette, paletteSize);
+  canvas->resetViewport();
+
+  for (int i = 0; i < pushCount; i++) {
+    const DamageRect& r = pushRects[i];
+    tft.setViewport(r.x, r.y, r.w, r.h, false);
+    metricsSetClip(r.x, r.y, r.w, r.h);
+    dmaPushSprite(*canvas, CANVAS_X, CANVAS_Y, overlays, overlayCount);
+    metricsRecordPush(r.x, r.y, r.w, r.h);
+    metricsClearClip();
+    tft.resetViewport();
+  }
+
+  releaseSprite(canvas);
+  canvas = nullptr;
+  overlayCount = 0;
+}
+
+// ==================== Drawing ====================
+bool contentCanvasActive() {
+  return canvas != nullptr;
+}
+
+TFT_eSPI& contentCanvas() {
+  return canvas != nullptr ? (TFT_eSPI&)*canvas : tft;
+}
+
+int contentOriginY() {
+  return canvas != nullptr ? CANVAS_Y : 0;
+}
+
+// Squared RGB565 distance, channels scaled to 6 bits
+static uint32_t colorDistance(uint16_t a, uint16_t b) {
+  int dr = ((a >> 11) - (b >> 11)) * 2;
+  int dg = ((a >> 5) & 0x3F) - ((b >> 5) & 0x3F);
+  int db = ((a & 0x1F) - (b & 0x1F)) * 2;
+  return dr * dr + dg * dg + db * db;
+}
+
+uint16_t contentInk(uint16_t color) {
+  if (canvas == nullptr) {
+    return color;
+  }
+  for (uint8_t i = 0; i < paletteSize; i++) {
+    if (palette[i] == color) {
+      return i;
+    }
+  }
+  if (paletteSize < 16) {
+    palette[paletteSize] = color;
+    return paletteSize++;
+  }
+
+  // Palette full: nearest existing colour
+  if (!paletteFullLogged) {
+    Serial.println("Content canvas: palette full, using nearest colours");
+    paletteFullLogged = true;
+  }
+  uint8_t best = 0;
+  uint32_t bestDist = UINT32_MAX;
+  for (uint8_t i = 0; i < 16; i++) {
+    uint32_t d = colorDistance(palette[i], color);
+    if (d < bestDist) {
+      bestDist = d;
+      best = i;
+    }
+  }
+  return best;
+}
+
+void drawContentImage(int x, int y, int w, int h, const uint16_t* image) {
+  if (canvas == nullptr) {
+    tft.pushImage(x, y, w, h, image);
+    metricsRecordPush(x, y, w, h);
+    return;
+  }
+  if (overlayCount < MAX_OVERLAYS) {
+    overlays[overlayCount++] = {(int16_t)x, (int16_t)(y + CANVAS_Y), (int16_t)w, (int16_t)h, image};
+  }
+}
+
+void contentRecordPush(int x, int y, int w, int h) {
+  if (canvas == nullptr) {
+    metricsRecordPush(x, y, w, h);
+  }
+}
+
+uint16_t contentColorAt(int x, int y) {
+  // The sprite's own palette is only set in endContentCanvas(): look the index up here
+  return palette[canvas->readPixelValue(x, y) & 0x0F];
+}
+
+// ==================== Render Tag ====================
+bool reuseContentCanvas(uint32_t tag) {
+  if (canvas == nullptr || tag == 0 || canvasTag != tag) {
+    return false;
+  }
+  // A full-area lease restarted the palette, but the pixels still use the render's
+  memcpy(palette, tagPalette, sizeof(palette));
+  paletteSize = tagPaletteSize;
+  return true;
+}
+
+void setContentCanvasTag(uint32_t tag) {
+  canvasTag = tag;
+  if (tag != 0) {
+    memcpy(tagPalette, palette, sizeof(tagPalette));
+    tagPaletteSize = paletteSize;
+  }
+}
+
+bool contentCanvasFull() {
+  return fullArea;
+}
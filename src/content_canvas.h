@@ -0,0 +1,59 @@
+#ifndef CONTENT_CANVAS_H
+#define CONTENT_CANVAS_H
+
+#include <TFT_eSPI.h>
+#include "state.h"
+
+/**
+ * Off-screen canvas for the three content zones: one 4-bit 320x195 sprite
+ * (31KB, a quarter of 16-bit) leased from the sprite pool for each redraw.
+ * Its viewport is the bounding box of the damage, and each damage rect is
+ * pushed from it, so the panel never shows a half-drawn frame.
+ *
+ * Colours go through contentInk(), which gives each RGB565 colour a palette
+ * index the first time it is drawn. The palette starts over whenever the
+ * whole area is redrawn, so every screen gets its own 16 entries; past 16 the
+ * nearest entry is used. Full-colour bitmaps (app icons) are pushed over the
+ * sprite as overlays.
+ *
+ * Without a sprite, draws go straight to the TFT one damage rect at a time:
+ * contentInk() passes colours through and contentOriginY() is 0.
+ */
+
+/**
+ * Lease the canvas for a redraw of the given damage rects (screen coordinates).
+ * @param intact - set true when the canvas still holds the previous redraw
+ * @return false if no sprite is available (draw directly instead)
+ */
+bool beginContentCanvas(const DamageRect* rects, int count, bool* intact);
+
+// Push the damage rects (with overlays) to the TFT and return the sprite
+void endContentCanvas();
+
+bool contentCanvasActive();
+TFT_eSPI& contentCanvas();  // The sprite while active, otherwise the TFT
+int contentOriginY();       // Screen y of canvas row 0
+
+// Colour value to draw with on the content canvas
+uint16_t contentInk(uint16_t color);
+
+// RGB565 colour drawn so far at canvas (x, y) in this redraw (canvas active, inside the viewport)
+uint16_t contentColorAt(int x, int y);
+
+// Draw a w x h image in panel byte order (pushImage with swap bytes off) at canvas (x, y)
+void drawContentImage(int x, int y, int w, int h, const uint16_t* image);
+
+// Record a direct TFT draw at canvas (x, y); canvas pushes are recorded by endContentCanvas()
+void contentRecordPush(int x, int y, int w, int h);
+
+// What the canvas holds outside the current damage (0 = unknown), for screens that
+// reuse their last full render. Cleared whenever the canvas isn't handed back intact.
+void setContentCanvasTag(uint32_t tag);
+// True if the canvas still holds the render tagged tag; its palette is then put back,
+// and the screen can leave the pixels as they are
+bool reuseContentCanvas(uint32_t tag);
+
+// True when the viewport covers the whole content area
+bool contentCanvasFull();
+
+#endif
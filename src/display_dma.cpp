@@ -0,0 +1,144 @@
+#include "display_dma.h"
+#include "config.h"
+#include "screen.h"
+
+// Stripe buffers live in internal RAM (.bss), which is DMA-capable
+static const int STRIPE_PIXELS = TFT_WIDTH * DMA_STRIPE_LINES;
+static uint16_t stripes[2][STRIPE_PIXELS];
+static int nextStripe = 0;
+
+// RGB332 -> byte-swapped RGB565, same expansion as TFT_eSPI's 8-bit pushImage
+static uint16_t rgb332ToSwapped[256];
+
+static bool dmaReady = false;
+static bool inTransfer = false;  // startWrite() issued, endWrite() pending
+
+// ==================== Init ====================
+void initDisplayDma() {
+  static const uint8_t blue[] = {0, 11, 21, 31};
+  for (int c = 0; c < 256; c++) {
+    uint16_t c16 = ((c & 0xE0) << 8) | ((c & 0xC0) << 5) | ((c & 0x1C) << 6) |
+                   ((c & 0x1C) << 3) | blue[c & 0x03];
+    rgb332ToSwapped[c] = (uint16_t)((c16 >> 8) | (c16 << 8));
+  }
+
+#if DISPLAY_DMA_ENABLED
+  dmaReady = tft.initDMA();
+  if (!dmaReady) {
+    Serial.println("DMA init failed - using blocking sprite pushes");
+  }
+#endif
+}
+
+// ==================== Push ====================
+static inline uint16_t swapped(uint16_t c) {
+  return (uint16_t)((c >> 8) | (c << 8));
+}
+
+// Blocking fallback for overlays, drawn over the pushed sprite
+static void pushOverlays(const DmaOverlay* overlays, int overlayCount) {
+  for (int o = 0; o < overlayCount; o++) {
+    const DmaOverlay& ov = overlays[o];
+    tft.pushImage(ov.x, ov.y, ov.w, ov.h, ov.image);
+  }
+}
+
+void dmaPushSprite(TFT_eSprite& sprite, int32_t x, int32_t y,
+                   const DmaOverlay* overlays, int overlayCount) {
+  int depth = sprite.getColorDepth();
+  if (!dmaReady || (depth != 16 && depth != 8 && depth != 4)) {
+    dmaFence();
+    sprite.pushSprite(x, y);
+    pushOverlays(overlays, overlayCount);
+    return;
+  }
+
+  // Clip to the viewport here so every stripe goes out unclipped
+  int32_t w = sprite.width(), h = sprite.height();
+  int32_t vx = tft.getViewportX(), vy = tft.getViewportY();
+  int32_t x0 = max(x, vx), y0 = max(y, vy);
+  int32_t x1 = min(x + w, vx + tft.getViewportWidth());
+  int32_t y1 = min(y + h, vy + tft.getViewportHeight());
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+  int32_t cw = x1 - x0;
+  int32_t linesPerStripe = STRIPE_PIXELS / cw;
+
+  // 4-bit: the sprite's palette, byte-swapped for the panel
+  uint16_t paletteSwapped[16];
+  if (depth == 4) {
+    for (int i = 0; i < 16; i++) {
+      paletteSwapped[i] = swapped(sprite.getPaletteColor(i));
+    }
+  }
+
+  const void* pixels = sprite.getPointer();
+  if (!inTransfer) {
+    tft.startWrite();
+    inTransfer = true;
+  }
+  bool swap = tft.getSwapBytes();
+  tft.setSwapBytes(false);  // Stripes are already in panel byte order
+
+  for (int32_t row = y0; row < y1; row += linesPerStripe) {
+    int32_t lines = min(linesPerStripe, y1 - row);
+    uint16_t* dst = stripes[nextStripe];
+
+    // Fill this stripe while the other one is still being sent
+    for (int32_t l = 0; l < lines; l++) {
+      int32_t srcOffset = (row - y + l) * w + (x0 - x);
+      uint16_t* out = dst + l * cw;
+      if (depth == 16) {
+        memcpy(out, (const uint16_t*)pixels + srcOffset, cw * sizeof(uint16_t));
+      } else if (depth == 8) {
+        const uint8_t* src = (const uint8_t*)pixels + srcOffset;
+        for (int32_t i = 0; i < cw; i++) {
+          out[i] = rgb332ToSwapped[src[i]];
+        }
+      } else {
+        // Two pixels per byte, even pixel index in the high nibble
+        const uint8_t* src = (const uint8_t*)pixels + (srcOffset >> 1);
+        int32_t i = 0;
+        if (srcOffset & 1) {
+          out[i++] = paletteSwapped[*src++ & 0x0F];
+        }
+        for (; i + 1 < cw; i += 2) {
+          uint8_t b = *src++;
+          out[i] = paletteSwapped[b >> 4];
+          out[i + 1] = paletteSwapped[b & 0x0F];
+        }
+        if (i < cw) {
+          out[i] = paletteSwapped[*src >> 4];
+        }
+      }
+    }
+
+    // Overlays over the part of the stripe they cover
+    for (int o = 0; o < overlayCount; o++) {
+      const DmaOverlay& ov = overlays[o];
+      int32_t ox0 = max((int32_t)ov.x, x0), ox1 = min((int32_t)(ov.x + ov.w), x1);
+      int32_t oy0 = max((int32_t)ov.y, row), oy1 = min((int32_t)(ov.y + ov.h), row + lines);
+      for (int32_t oy = oy0; oy < oy1 && ox0 < ox1; oy++) {
+        memcpy(dst + (oy - row) * cw + (ox0 - x0), ov.image + (oy - ov.y) * ov.w + (ox0 - ov.x),
+               (ox1 - ox0) * sizeof(uint16_t));
+      }
+    }
+
+    // Waits for the previous stripe, so the other buffer is free once this returns
+    tft.pushImageDMA(x0, row, cw, lines, dst);
+    nextStripe ^= 1;
+  }
+
+  tft.setSwapBytes(swap);
+}
+
+// ==================== Fence ====================
+void dmaFence() {
+  if (!inTransfer) {
+    return;
+  }
+  tft.dmaWait();
+  tft.endWrite();
+  inTransfer = false;
+}
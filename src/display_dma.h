@@ -0,0 +1,39 @@
+#ifndef DISPLAY_DMA_H
+#define DISPLAY_DMA_H
+
+#include <TFT_eSPI.h>
+
+/**
+ * Sprite pushes over SPI DMA. A sprite is sent in DMA_STRIPE_LINES stripes
+ * through two stripe buffers: while one stripe is on the wire the next is
+ * copied (16-bit) or expanded (8- and 4-bit) into the other. The sprite itself is
+ * free to redraw as soon as dmaPushSprite() returns; the last stripe is still
+ * in flight, so call dmaFence() before drawing to the TFT directly.
+ */
+
+// Start DMA on the TFT and build the 8-bit colour table (call after tft.init)
+void initDisplayDma();
+
+/**
+ * Full-colour image laid over a sprite as it is pushed, for bitmaps a 4-bit
+ * sprite cannot hold (app icons). Screen coordinates; pixels are in panel
+ * byte order (the data pushImage takes with swap bytes off).
+ */
+struct DmaOverlay {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  const uint16_t* image;
+};
+
+// Push a 16-, 8- or 4-bit sprite with its top-left at (x, y), clipped to the TFT viewport,
+// with any overlays copied over it. 1-bit sprites, or DMA being unavailable, fall back
+// to a blocking pushSprite.
+void dmaPushSprite(TFT_eSprite& sprite, int32_t x, int32_t y,
+                   const DmaOverlay* overlays = nullptr, int overlayCount = 0);
+
+// Wait for the outstanding transfer and release the bus
+void dmaFence();
+
+#endif
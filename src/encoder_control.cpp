@@ -1,13 +1,17 @@
 #include "encoder_control.h"
 #include "config.h"
 #include "motor_control.h"
+#include "state.h"
+#include "notif_screen.h"
 
-// Encoder state
+// Encoder state (input task)
 static int lastCLK = HIGH;
+
+// Motor state (render task)
 static bool motorRunning = false;
 static int targetSpeed = 0;  // Default mid-speed
 
-// Button state
+// Button state (input task)
 static bool lastBtnState = HIGH;
 static unsigned long lastBtnDebounce = 0;
 
@@ -26,55 +30,73 @@ void initEncoder() {
 #endif
 }
 
-void checkEncoder() {
+int pollEncoderTurn() {
 #if !ENCODER_ENABLED
-  return;
+  return 0;
 #endif
-  // --- Rotation handling ---
+  int turn = 0;
   int currentCLK = digitalRead(ENCODER_CLK);
 
   if (currentCLK != lastCLK && currentCLK == LOW) {
     // CLK changed, check direction via DT
     int dtValue = digitalRead(ENCODER_DT);
-
-    if (dtValue != currentCLK) {
-      // Clockwise - increase speed
-      targetSpeed = min(255, targetSpeed + ENCODER_SPEED_STEP);
-    } else {
-      // Counter-clockwise - decrease speed
-      targetSpeed = max(ENCODER_MIN_SPEED, targetSpeed - ENCODER_SPEED_STEP);
-    }
-
-    Serial.printf("Encoder: speed=%d\n", targetSpeed);
-
-    // Update motor if running
-    if (motorRunning) {
-      setMotorRaw(targetSpeed);
-    }
+    turn = (dtValue != currentCLK) ? 1 : -1;
   }
   lastCLK = currentCLK;
+  return turn;
+}
 
-  // --- Button handling ---
+bool pollEncoderButton() {
+#if !ENCODER_ENABLED
+  return false;
+#endif
   bool currentBtn = digitalRead(ENCODER_SW);
+  bool pressed = false;
 
   if (currentBtn != lastBtnState) {
     if (millis() - lastBtnDebounce > BTN_DEBOUNCE_MS) {
       lastBtnDebounce = millis();
 
       // Button pressed (HIGH -> LOW with pull-up)
-      if (currentBtn == LOW) {
-        motorRunning = !motorRunning;
-
-        if (motorRunning) {
-          setMotorRaw(targetSpeed);
-          Serial.printf("Motor ON at speed %d\n", targetSpeed);
-        } else {
-          setMotorRaw(0);
-          Serial.println("Motor OFF");
-        }
-      }
-
+      pressed = (currentBtn == LOW);
       lastBtnState = currentBtn;
     }
   }
+  return pressed;
+}
+
+void encoderTurned(int direction) {
+  // Once a clear-button hold has opened history, the encoder pages it
+  // (clockwise goes back); turning back to the latest page returns it to speed
+  if (browsingNotifHistory()) {
+    pageNotifHistory(direction, false);
+    return;
+  }
+
+  if (direction > 0) {
+    // Clockwise - increase speed
+    targetSpeed = min(255, targetSpeed + ENCODER_SPEED_STEP);
+  } else {
+    // Counter-clockwise - decrease speed
+    targetSpeed = max(ENCODER_MIN_SPEED, targetSpeed - ENCODER_SPEED_STEP);
+  }
+
+  Serial.printf("Encoder: speed=%d\n", targetSpeed);
+
+  // Update motor if running
+  if (motorRunning) {
+    setMotorRaw(targetSpeed);
+  }
+}
+
+void encoderPressed() {
+  motorRunning = !motorRunning;
+
+  if (motorRunning) {
+    setMotorRaw(targetSpeed);
+    Serial.printf("Motor ON at speed %d\n", targetSpeed);
+  } else {
+    setMotorRaw(0);
+    Serial.println("Motor OFF");
+  }
 }
@@ -6,7 +6,15 @@
 // Initialize encoder pins
 void initEncoder();
 
-// Check encoder and handle actions (call in loop)
-void checkEncoder();
+// Poll the encoder (input task): rotation since the last poll (1 = clockwise,
+// -1 = counter-clockwise, 0 = none) and a debounced button press
+int pollEncoderTurn();
+bool pollEncoderButton();
+
+// Act on them (render task): motor speed and on/off on every screen. While
+// history is open (a clear-button hold) turning pages it instead, until it is
+// back on the latest page or times out
+void encoderTurned(int direction);
+void encoderPressed();
 
 #endif
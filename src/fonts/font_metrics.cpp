@@ -0,0 +1,119 @@
+// Auto-generated by tools/generate_fonts.py from src/fonts/*pt7b.h - do not edit
+#include "font_metrics.h"
+
+static const uint8_t MDIOTrial_Bold10pt7bAdvance[95] PROGMEM = {
+   12,  12,  12,  13,  12,  13,  13,  11,  12,  12,  13,  11,  12,  11,  12,  12,
+   12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  11,
+   13,  12,  12,  12,  12,  11,  12,  12,  12,  11,  11,  12,  12,  13,  12,  12,
+   12,  12,  12,  12,  12,  11,  12,  13,  12,  11,  11,  12,  12,  12,  12,  13,
+   12,  11,  12,  12,  12,  12,  12,  12,  11,  12,  12,  11,  12,  13,  11,  12,
+   12,  12,  12,  12,  12,  11,  12,  12,  12,  12,  12,  12,  11,  12,  12
+};
+
+static const int8_t MDIOTrial_Bold10pt7bInk[95] PROGMEM = {
+    1,   8,  10,  12,  11,  12,  12,   7,  10,   9,  12,  10,   8,   9,   8,  10,
+   12,  11,  10,  11,  11,  10,  11,  10,  11,  11,   8,   8,  11,  11,  11,  10,
+   12,  11,  11,  11,  11,  10,  11,  11,  11,  10,  10,  11,  11,  12,  11,  11,
+   11,  11,  11,  11,  11,  10,  11,  12,  11,  11,  10,  10,  10,   9,  11,  11,
+    9,  10,  11,  11,  11,  11,  11,  11,  10,  11,  10,  11,  11,  12,  10,  11,
+   11,  11,  11,  11,  11,  10,  11,  12,  11,  11,  11,  10,   7,  11,  11
+};
+
+static const uint8_t MDIOTrial_Bold8pt7bAdvance[95] PROGMEM = {
+    9,   9,  10,  11,  11,  11,  10,  11,   9,  10,  10,   9,   9,  10,   9,   9,
+    9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,  10,  10,   9,
+   11,   9,  10,  11,  10,   9,   9,  11,  10,   9,  10,  10,  10,  10,  10,  11,
+   10,  11,  10,  10,  10,  10,   9,  10,   9,   9,  10,   9,   9,  10,   9,   9,
+    9,  10,  10,  10,  10,  10,  10,  10,  10,  10,   9,  10,  10,  10,  10,  10,
+   10,  10,  10,  10,  10,  10,   9,   9,   9,   9,   9,   9,   9,  10,  10
+};
+
+static const int8_t MDIOTrial_Bold8pt7bInk[95] PROGMEM = {
+    1,   6,   8,  10,  10,  10,  10,   7,   8,   8,   9,   8,   7,   8,   6,   8,
+    9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   6,   6,   9,   9,   9,   8,
+   10,   9,   9,  10,   9,   8,   8,  10,   9,   8,   9,  10,   9,   9,   9,  10,
+    9,  10,   9,   9,   9,   9,   9,   9,   9,   9,   9,   8,   8,   8,   9,   8,
+    7,   9,   9,   9,   9,   9,   9,   9,   9,   9,   8,  10,   9,   9,   9,   9,
+    9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   8,   6,   9,   9
+};
+
+static const uint8_t MDIOTrial_Bold9pt7bAdvance[95] PROGMEM = {
+   11,  10,  11,  12,  11,  12,  12,  11,  10,  10,  10,  10,  11,  10,  10,  11,
+   11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  10,  10,  11,  11,  11,  10,
+   12,  11,  11,  11,  11,  10,  11,  12,  11,  10,  11,  11,  11,  12,  11,  12,
+   11,  12,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  10,
+   11,  11,  11,  11,  11,  11,  11,  11,  10,  11,  10,  11,  11,  11,  10,  11,
+   11,  11,  11,  11,  11,  10,  11,  11,  11,  11,  10,  10,  11,  10,  11
+};
+
+static const int8_t MDIOTrial_Bold9pt7bInk[95] PROGMEM = {
+    1,   7,   9,  11,  10,  11,  11,   7,   8,   8,  10,   9,   8,   8,   7,   9,
+   11,  10,  10,  10,  10,   9,  10,  10,  10,  10,   7,   7,  10,  10,  10,   9,
+   11,  10,  10,  10,  10,   9,  10,  11,  10,   9,  10,  11,  10,  11,  10,  11,
+   10,  11,  10,  10,  10,  10,  10,  10,  10,  11,  10,   9,   9,   8,  10,   9,
+    8,  10,  10,  10,  10,  10,  10,  10,   9,  10,   8,  10,  10,  10,   9,  10,
+   10,  10,  10,  10,  10,   9,  10,  10,  10,  10,  10,   9,   7,   9,  10
+};
+
+static const uint8_t MDIOTrial_Regular10pt7bAdvance[95] PROGMEM = {
+   12,  11,  12,  13,  11,  13,  12,  12,  12,  12,  12,  11,  12,  11,  11,  12,
+   12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  11,  11,  12,  11,  12,  12,
+   12,  12,  12,  12,  11,  12,  12,  12,  11,  11,  12,  12,  11,  12,  11,  12,
+   12,  12,  12,  12,  12,  11,  12,  12,  12,  12,  11,  12,  12,  12,  12,  12,
+   12,  12,  12,  11,  12,  11,  11,  12,  12,  11,  11,  12,  11,  12,  12,  11,
+   12,  12,  12,  12,  11,  12,  12,  12,  12,  12,  12,  11,  12,  11,  12
+};
+
+static const int8_t MDIOTrial_Regular10pt7bInk[95] PROGMEM = {
+    1,   7,   9,  12,  10,  12,  12,   7,  10,   9,  11,  10,   8,   9,   7,  10,
+   11,  10,  11,  10,  10,  10,  10,  11,  10,  10,   7,   7,  10,  10,  11,  10,
+   11,  11,  11,  11,  10,  11,  10,  11,  10,  10,  10,  12,  10,  11,  10,  11,
+   11,  11,  11,  11,  11,  10,  11,  12,  11,  11,  10,  10,  10,   8,  11,  10,
+    8,  10,  11,  10,  10,  10,  11,  10,  10,  10,   8,  11,  10,  11,  10,  10,
+   11,  10,  11,  10,  10,  10,  11,  12,  11,  11,  10,  10,   7,  10,  11
+};
+
+static const uint8_t MDIOTrial_Regular8pt7bAdvance[95] PROGMEM = {
+    9,  10,   9,  11,   9,  11,  10,   9,   9,   8,   9,   9,   9,  10,   9,   9,
+    9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,  10,
+   10,   9,   9,   9,   9,   9,   9,  10,   9,   9,   9,   9,   9,  10,   9,  10,
+    9,  10,   9,   9,  10,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,
+    9,   9,   9,   9,   9,   9,   9,   9,   8,   9,   9,   9,   9,   9,   8,   9,
+    9,   9,  10,   9,   9,   8,   9,   9,   9,   9,  10,   9,   9,   9,   9
+};
+
+static const int8_t MDIOTrial_Regular8pt7bInk[95] PROGMEM = {
+    1,   6,   7,  10,   8,  10,  10,   5,   7,   6,   8,   8,   6,   8,   6,   8,
+    9,   8,   8,   8,   8,   8,   8,   8,   8,   8,   6,   6,   8,   8,   8,   8,
+    9,   9,   8,   8,   8,   7,   8,   9,   8,   8,   8,   8,   8,   9,   8,   9,
+    8,   9,   8,   8,   9,   8,   9,   9,   9,   8,   8,   7,   8,   6,   9,   8,
+    6,   7,   8,   8,   8,   8,   9,   8,   7,   8,   7,   9,   8,   8,   7,   8,
+    8,   8,   9,   7,   8,   7,   9,   9,   8,   8,   8,   8,   5,   8,   8
+};
+
+static const uint8_t MDIOTrial_Regular9pt7bAdvance[95] PROGMEM = {
+   11,  10,  12,  12,  11,  12,  11,  10,  11,  11,  12,  10,  11,  10,  11,  11,
+   11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  11,  10,  10,  11,  11,
+   11,  11,  10,  11,  11,  11,  11,  11,  10,  10,  11,  12,  11,  11,  10,  11,
+   11,  11,  10,  11,  11,  10,  11,  11,  11,  12,  10,  11,  11,  11,  11,  12,
+   11,  11,  11,  11,  11,  10,  10,  11,  12,  10,  10,  11,  10,  10,  12,  10,
+   11,  11,  11,  12,  10,  12,  11,  11,  11,  11,  11,  11,  12,  11,  11
+};
+
+static const int8_t MDIOTrial_Regular9pt7bInk[95] PROGMEM = {
+    1,   6,   9,  11,  10,  11,  11,   6,   9,   8,  11,   9,   7,   8,   7,   9,
+   10,   9,   9,  10,   9,  10,   9,   9,  10,   9,   7,   7,   9,   9,  10,   9,
+   10,  10,   9,  10,  10,  10,  10,  10,   9,   9,   9,  11,  10,  10,   9,  10,
+   10,  10,   9,  10,  10,   9,  10,  10,  10,  11,   9,   9,   9,   8,  10,  10,
+    7,   9,  10,   9,   9,   9,  10,   9,  10,   9,   8,  10,   9,   9,  10,   9,
+   10,   9,  10,  10,   9,  10,  10,  10,  10,  10,   9,   9,   7,  10,  10
+};
+
+const FontMetrics FONT_METRICS[FONT_COUNT] = {
+  {0x20, 0x7E, 24, MDIOTrial_Bold10pt7bAdvance, MDIOTrial_Bold10pt7bInk},  // FONT_BOLD_10
+  {0x20, 0x7E, 19, MDIOTrial_Bold8pt7bAdvance, MDIOTrial_Bold8pt7bInk},  // FONT_BOLD_8
+  {0x20, 0x7E, 21, MDIOTrial_Bold9pt7bAdvance, MDIOTrial_Bold9pt7bInk},  // FONT_BOLD_9
+  {0x20, 0x7E, 24, MDIOTrial_Regular10pt7bAdvance, MDIOTrial_Regular10pt7bInk},  // FONT_REGULAR_10
+  {0x20, 0x7E, 19, MDIOTrial_Regular8pt7bAdvance, MDIOTrial_Regular8pt7bInk},  // FONT_REGULAR_8
+  {0x20, 0x7E, 21, MDIOTrial_Regular9pt7bAdvance, MDIOTrial_Regular9pt7bInk},  // FONT_REGULAR_9
+};
@@ -0,0 +1,24 @@
+// Auto-generated by tools/generate_fonts.py from src/fonts/*pt7b.h - do not edit
+#pragma once
+#include <Arduino.h>
+
+// Fonts with glyph metrics tables (same order as FONT_METRICS)
+enum FontId {
+  FONT_BOLD_10,  // MDIOTrial_Bold10pt7b
+  FONT_BOLD_8,  // MDIOTrial_Bold8pt7b
+  FONT_BOLD_9,  // MDIOTrial_Bold9pt7b
+  FONT_REGULAR_10,  // MDIOTrial_Regular10pt7b
+  FONT_REGULAR_8,  // MDIOTrial_Regular8pt7b
+  FONT_REGULAR_9,  // MDIOTrial_Regular9pt7b
+  FONT_COUNT
+};
+
+struct FontMetrics {
+  uint8_t first;           // First character in the tables
+  uint8_t last;            // Last character in the tables
+  uint8_t yAdvance;        // Line height
+  const uint8_t* advance;  // xAdvance per glyph
+  const int8_t* ink;       // xOffset + width per glyph (right edge of the ink)
+};
+
+extern const FontMetrics FONT_METRICS[FONT_COUNT];
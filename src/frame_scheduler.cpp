@@ -0,0 +1,247 @@
+#include "frame_scheduler.h"
+#include "config.h"
+#include "screen.h"
+#include "state.h"
+#include "command_queue.h"
+#include "notif_screen.h"
+#include "seqlock.h"
+
+// ==================== Tasks ====================
+struct FrameTask {
+  const char* name;
+  uint16_t periodMs;    // 0 = on demand only
+  uint16_t deadlineMs;  // How long after becoming due the task may run
+  bool deferrable;      // May wait for a later frame to keep this one in budget
+  bool (*pending)();    // Damage that makes the task due outside its period
+  uint32_t (*holdMs)(); // How long pending damage must still wait (debounce), or nullptr
+  void (*run)();
+};
+
+static bool statusDirty() {
+  return isZoneDirty(ZONE_STATUS);
+}
+
+static bool clockDirty() {
+  return isZoneDirty(ZONE_CLOCK);
+}
+
+static bool titleDirty() {
+  return isZoneDirty(ZONE_TITLE);
+}
+
+// Priority order: earlier tasks run first in each frame
+static const FrameTask TASKS[] = {
+  {"status",  0,                     FRAME_PERIOD_MS,     false, statusDirty,    nullptr,            refreshStatusZone},
+  {"clock",   CLOCK_UPDATE_INTERVAL, CLOCK_DEADLINE_MS,   false, clockDirty,     nullptr,            refreshClockZone},
+  {"title",   0,                     CONTENT_DEADLINE_MS, true,  titleDirty,     notifRepaintHoldMs, refreshTitleZone},
+  {"content", 0,                     CONTENT_DEADLINE_MS, true,  isContentDirty, notifRepaintHoldMs, refreshContentZones},
+};
+static const int TASK_COUNT = sizeof(TASKS) / sizeof(TASKS[0]);
+
+struct FrameTaskState {
+  unsigned long nextDue;  // Next periodic tick
+  unsigned long dueAt;    // When the current wait started
+  bool waiting;
+  uint32_t runs;
+  uint32_t deferrals;
+  uint32_t holds;         // Frames where pending damage was held back
+  uint32_t missed;
+  uint32_t maxLateMs;
+  uint32_t avgUs;         // Moving average of draw time (1/8 weight per run)
+  uint32_t maxUs;
+};
+
+static FrameTaskState taskState[TASK_COUNT];
+static unsigned long nextFrame = 0;
+static uint32_t frameCount = 0;
+static uint32_t frameOverruns = 0;  // Frames that started a whole period late
+static uint32_t idleGaps = 0;       // Frames skipped because nothing was due
+static bool sleptPastFrame = false; // frameSchedulerWaitMs() let the next frame go by
+static uint32_t maxFrameUs = 0;
+
+// The counters as /frames serves them. Only the render task runs frames; it
+// publishes a copy after each one so the AsyncTCP task never reads taskState
+// mid-update.
+struct FrameTaskReport {
+  uint32_t runs;
+  uint32_t deferrals;
+  uint32_t holds;
+  uint32_t missed;
+  uint32_t maxLateMs;
+  uint32_t avgUs;
+  uint32_t maxUs;
+};
+
+struct FrameSchedulerReport {
+  uint32_t frames;
+  uint32_t overruns;
+  uint32_t idleGaps;
+  uint32_t maxFrameUs;
+  FrameTaskReport tasks[TASK_COUNT];
+};
+
+static Seqlock<FrameSchedulerReport> report;
+
+// ==================== Helpers ====================
+static void publishReport() {
+  FrameSchedulerReport r;
+  r.frames = frameCount;
+  r.overruns = frameOverruns;
+  r.idleGaps = idleGaps;
+  r.maxFrameUs = maxFrameUs;
+  for (int t = 0; t < TASK_COUNT; t++) {
+    const FrameTaskState& s = taskState[t];
+    r.tasks[t] = {s.runs, s.deferrals, s.holds, s.missed, s.maxLateMs, s.avgUs, s.maxUs};
+  }
+  report.publish(r);
+}
+
+// ==================== Init ====================
+void initFrameScheduler() {
+  unsigned long now = millis();
+  memset(taskState, 0, sizeof(taskState));
+  for (int t = 0; t < TASK_COUNT; t++) {
+    taskState[t].nextDue = now + TASKS[t].periodMs;
+  }
+  nextFrame = now;
+}
+
+// ==================== Frame ====================
+void runFrameScheduler() {
+  unsigned long now = millis();
+  if ((long)(now - nextFrame) < 0) {
+    return;
+  }
+
+  // Keep the cadence; after a stall or an idle gap restart it rather than
+  // running a burst
+  if (now - nextFrame >= FRAME_PERIOD_MS) {
+    if (sleptPastFrame) {
+      idleGaps++;
+    } else {
+      frameOverruns++;
+    }
+    nextFrame = now;
+  }
+  sleptPastFrame = false;
+  nextFrame += FRAME_PERIOD_MS;
+  frameCount++;
+
+  // Apply API commands first, so this frame draws their result
+  drainCommandQueue();
+
+  unsigned long frameStart = micros();
+  for (int t = 0; t < TASK_COUNT; t++) {
+    const FrameTask& task = TASKS[t];
+    FrameTaskState& s = taskState[t];
+
+    bool tick = task.periodMs > 0 && (long)(now - s.nextDue) >= 0;
+    if (!tick && !(task.pending && task.pending())) {
+      continue;
+    }
+    // Held damage isn't due yet, so it doesn't start the deadline either
+    if (!tick && !s.waiting && task.holdMs && task.holdMs() > 0) {
+      s.holds++;
+      continue;
+    }
+    if (!s.waiting) {
+      s.waiting = true;
+      s.dueAt = tick ? s.nextDue : now;
+    }
+
+    // Defer only what would fit in a later frame; a draw longer than the whole
+    // budget gains nothing from waiting
+    unsigned long lateMs = millis() - s.dueAt;
+    uint32_t usedUs = micros() - frameStart;
+    if (task.deferrable && lateMs < task.deadlineMs && s.avgUs <= FRAME_BUDGET_US &&
+        usedUs + s.avgUs > FRAME_BUDGET_US) {
+      s.deferrals++;
+      continue;
+    }
+
+    unsigned long start = micros();
+    task.run();
+    uint32_t us = micros() - start;
+
+    s.waiting = false;
+    s.runs++;
+    s.avgUs = s.avgUs - s.avgUs / 8 + us / 8;
+    if (us > s.maxUs) s.maxUs = us;
+    if (lateMs > task.deadlineMs) s.missed++;
+    if (lateMs > s.maxLateMs) s.maxLateMs = lateMs;
+
+    if (tick) {
+      s.nextDue += task.periodMs;
+      // Drop ticks lost to a stall (the late run above already counted as missed)
+      if ((long)(now - s.nextDue) >= 0) {
+        s.nextDue = now + task.periodMs;
+      }
+    }
+  }
+
+  uint32_t frameUs = micros() - frameStart;
+  if (frameUs > maxFrameUs) maxFrameUs = frameUs;
+  publishReport();
+}
+
+// ==================== Idle ====================
+uint32_t frameSchedulerWaitMs() {
+  unsigned long now = millis();
+  uint32_t untilFrame = (long)(nextFrame - now) > 0 ? nextFrame - now : 0;
+
+  // Damage and queued commands are drawn at the next frame
+  bool due = commandsQueued();
+  uint32_t wait = UINT32_MAX;
+  for (int t = 0; t < TASK_COUNT && !due; t++) {
+    const FrameTask& task = TASKS[t];
+    const FrameTaskState& s = taskState[t];
+    bool pending = task.pending && task.pending();
+    uint32_t hold = pending && !s.waiting && task.holdMs ? task.holdMs() : 0;
+    if (hold > 0) {
+      wait = min(wait, max(hold, untilFrame));
+    } else {
+      due = s.waiting || pending;
+    }
+    if (task.periodMs > 0) {
+      uint32_t untilDue = (long)(s.nextDue - now) > 0 ? s.nextDue - now : 0;
+      wait = min(wait, max(untilDue, untilFrame));
+    }
+  }
+  if (due) {
+    wait = untilFrame;
+  }
+  sleptPastFrame = wait > untilFrame;
+  return wait;
+}
+
+// ==================== Reporting ====================
+String frameSchedulerJson() {
+  FrameSchedulerReport r;
+  report.read(r);
+
+  String out = "{\"period_ms\":" + String(FRAME_PERIOD_MS);
+  out += ",\"budget_us\":" + String(FRAME_BUDGET_US);
+  out += ",\"frames\":" + String(r.frames);
+  out += ",\"overruns\":" + String(r.overruns);
+  out += ",\"idle_gaps\":" + String(r.idleGaps);
+  out += ",\"max_frame_us\":" + String(r.maxFrameUs);
+  out += ",\"tasks\":[";
+  for (int t = 0; t < TASK_COUNT; t++) {
+    const FrameTaskReport& s = r.tasks[t];
+    if (t > 0) out += ",";
+    out += "{\"task\":\"";
+    out += TASKS[t].name;
+    out += "\",\"period_ms\":" + String(TASKS[t].periodMs);
+    out += ",\"deadline_ms\":" + String(TASKS[t].deadlineMs);
+    out += ",\"runs\":" + String(s.runs);
+    out += ",\"deferrals\":" + String(s.deferrals);
+    out += ",\"holds\":" + String(s.holds);
+    out += ",\"missed\":" + String(s.missed);
+    out += ",\"max_late_ms\":" + String(s.maxLateMs);
+    out += ",\"avg_us\":" + String(s.avgUs);
+    out += ",\"max_us\":" + String(s.maxUs);
+    out += "}";
+  }
+  out += "]}";
+  return out;
+}
@@ -0,0 +1,35 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+
+/**
+ * Frame clock for screen rendering. Frames run at most every FRAME_PERIOD_MS,
+ * and only while something is due: the scheduler applies queued API commands
+ * (command_queue.h), then runs the zone tasks in priority order: the status
+ * ticker (when dirty), the clock (1 Hz, or at once after its zone is
+ * damaged), then the title and content zones on demand.
+ *
+ * Title and content are deferrable: if their average draw time would take
+ * the frame past FRAME_BUDGET_US they wait for a later frame, until their
+ * deadline is reached. A task that runs after its deadline counts as missed.
+ * They are also held while a notification burst settles (notifRepaintHoldMs()),
+ * so a burst is drawn once; the deadline starts when the hold ends.
+ */
+
+void initFrameScheduler();
+
+// Run a frame if one is due (call from the render task, see tasks.h)
+void runFrameScheduler();
+
+/**
+ * How long the render task may sleep: until the next frame while anything is
+ * damaged or queued, otherwise until the next periodic task (the clock tick).
+ * Frames skipped that way count as idle gaps, not overruns.
+ */
+uint32_t frameSchedulerWaitMs();
+
+// Per-task runs, deferrals, missed deadlines and draw times, served by /frames
+String frameSchedulerJson();
+
+#endif
@@ -0,0 +1,69 @@
+#include "heap_stats.h"
+#include "config.h"
+#include "arena.h"
+
+struct HeapSample {
+  uint32_t uptimeS;
+  uint32_t freeBytes;
+  uint32_t maxAlloc;  // Largest block that can be allocated
+  uint32_t minFree;   // Low-water mark since boot
+};
+
+static HeapSample history[HEAP_HISTORY_SAMPLES];
+static int historyHead = 0;   // Next slot to write
+static int historyCount = 0;
+static unsigned long lastSample = 0;
+static bool sampled = false;
+
+// 100 - largest block as a share of free heap: 0 = one contiguous region
+static int fragmentationPct(uint32_t freeBytes, uint32_t maxAlloc) {
+  if (freeBytes == 0 || maxAlloc >= freeBytes) {
+    return 0;
+  }
+  return 100 - (int)((uint64_t)maxAlloc * 100 / freeBytes);
+}
+
+// ==================== Sampling ====================
+void heapStatsTick() {
+  unsigned long now = millis();
+  if (sampled && now - lastSample < HEAP_SAMPLE_INTERVAL_MS) {
+    return;
+  }
+  sampled = true;
+  lastSample = now;
+
+  HeapSample& s = history[historyHead];
+  s.uptimeS = now / 1000;
+  s.freeBytes = ESP.getFreeHeap();
+  s.maxAlloc = ESP.getMaxAllocHeap();
+  s.minFree = ESP.getMinFreeHeap();
+  historyHead = (historyHead + 1) % HEAP_HISTORY_SAMPLES;
+  if (historyCount < HEAP_HISTORY_SAMPLES) historyCount++;
+}
+
+// ==================== Reporting ====================
+String heapJson() {
+  uint32_t freeBytes = ESP.getFreeHeap();
+  uint32_t maxAlloc = ESP.getMaxAllocHeap();
+
+  String out = "{\"free_heap\":" + String(freeBytes);
+  out += ",\"max_alloc\":" + String(maxAlloc);
+  out += ",\"min_free\":" + String(ESP.getMinFreeHeap());
+  out += ",\"fragmentation_pct\":" + String(fragmentationPct(freeBytes, maxAlloc));
+  out += ",\"arenas\":[" + arenaJson() + "]";
+  out += ",\"sample_interval_ms\":" + String(HEAP_SAMPLE_INTERVAL_MS);
+  out += ",\"history\":[";
+  // Oldest first
+  for (int i = 0; i < historyCount; i++) {
+    const HeapSample& s = history[(historyHead - historyCount + i + HEAP_HISTORY_SAMPLES) % HEAP_HISTORY_SAMPLES];
+    if (i > 0) out += ",";
+    out += "{\"uptime_s\":" + String(s.uptimeS);
+    out += ",\"free\":" + String(s.freeBytes);
+    out += ",\"max_alloc\":" + String(s.maxAlloc);
+    out += ",\"min_free\":" + String(s.minFree);
+    out += ",\"fragmentation_pct\":" + String(fragmentationPct(s.freeBytes, s.maxAlloc));
+    out += "}";
+  }
+  out += "]}";
+  return out;
+}
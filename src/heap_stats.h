@@ -0,0 +1,19 @@
+#ifndef HEAP_STATS_H
+#define HEAP_STATS_H
+
+#include <Arduino.h>
+
+/**
+ * Heap history for spotting fragmentation over days of uptime. The network
+ * task samples free heap, the largest allocatable block and the low-water mark
+ * every HEAP_SAMPLE_INTERVAL_MS into a ring; a largest block that keeps
+ * shrinking while free heap stays flat is fragmentation.
+ */
+
+// Take a sample when one is due (network task)
+void heapStatsTick();
+
+// Current heap, fragmentation, arena usage and the sample history, served by GET /heap
+String heapJson();
+
+#endif
@@ -0,0 +1,279 @@
+#include "icon_cache.h"
+#include <LittleFS.h>
+#include <atomic>
+#include "seqlock.h"
+
+static const int ICON_KEY_MAX = 31;                       // Same cut as lookupAppIcon()
+static const int ICON_PIXELS = ICON_WIDTH * ICON_HEIGHT;
+static const int ICON_FILE_BYTES = ICON_KEY_MAX + 1 + ICON_CACHE_BYTES;  // Name, then pixels
+
+struct IconSlot {
+  uint32_t key;       // 0 = empty
+  uint32_t lastUsed;  // Access stamp for LRU eviction
+  char name[ICON_KEY_MAX + 1];  // Normalised app name the icon was stored for
+  uint16_t pixels[ICON_PIXELS];
+};
+
+static IconSlot slots[ICON_CACHE_RAM_SLOTS];
+static uint32_t accessClock = 0;
+static bool mounted = false;
+
+// Counters
+static uint32_t hits = 0;
+static uint32_t misses = 0;
+static uint32_t flashReads = 0;
+static uint32_t stores = 0;        // Icons put in RAM after a save
+static uint32_t failures = 0;
+// Bumped by the network task, which does the flash writes
+static std::atomic<uint32_t> saves(0);
+static std::atomic<uint32_t> saveFailures(0);
+static uint32_t mismatches = 0;  // Key found, but stored for another app name
+
+// The render task's counters as /icons serves them, published after every
+// lookup and store so the AsyncTCP task never scans slots[] mid-update
+struct IconCacheReport {
+  uint32_t ramUsed;
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t flashReads;
+  uint32_t stores;
+  uint32_t failures;
+  uint32_t mismatches;
+};
+static Seqlock<IconCacheReport> report;
+
+// ==================== Helpers ====================
+static void publishReport() {
+  IconCacheReport r = {0, hits, misses, flashReads, stores, failures, mismatches};
+  for (int i = 0; i < ICON_CACHE_RAM_SLOTS; i++) {
+    if (slots[i].key != 0) r.ramUsed++;
+  }
+  report.publish(r);
+}
+
+// Lower-cased, cut to ICON_KEY_MAX; buf must hold ICON_KEY_MAX + 1
+static int normaliseName(const char* app, char* buf) {
+  int len = 0;
+  while (len < ICON_KEY_MAX && app[len] != '\0') {
+    buf[len] = tolower(app[len]);
+    len++;
+  }
+  buf[len] = '\0';
+  return len;
+}
+
+// FNV-1a; 0 is reserved for "no icon"
+static uint32_t iconKey(const char* name, int len) {
+  uint32_t h = 0x811C9DC5UL;
+  for (int i = 0; i < len; i++) {
+    h = (h ^ (uint8_t)name[i]) * 16777619UL;
+  }
+  return h != 0 ? h : 1;
+}
+
+static void iconPath(uint32_t key, char* path, size_t size) {
+  snprintf(path, size, ICON_CACHE_DIR "/%08lx.bin", (unsigned long)key);
+}
+
+// name nullptr: any app; otherwise the slot must have been stored for name
+static IconSlot* findSlot(uint32_t key, const char* name) {
+  for (int i = 0; i < ICON_CACHE_RAM_SLOTS; i++) {
+    if (slots[i].key == key && (name == nullptr || strcmp(slots[i].name, name) == 0)) {
+      slots[i].lastUsed = ++accessClock;
+      return &slots[i];
+    }
+  }
+  return nullptr;
+}
+
+// An empty slot, or the least recently used one
+static IconSlot* victimSlot() {
+  IconSlot* victim = &slots[0];
+  for (int i = 0; i < ICON_CACHE_RAM_SLOTS; i++) {
+    if (slots[i].key == 0) {
+      return &slots[i];
+    }
+    if (slots[i].lastUsed < victim->lastUsed) {
+      victim = &slots[i];
+    }
+  }
+  return victim;
+}
+
+// Read an icon file into a RAM slot; nullptr if there is no such file, or
+// (name not nullptr) it was stored for another app whose name hashes the same
+static IconSlot* loadSlot(uint32_t key, const char* name) {
+  if (!mounted) {
+    return nullptr;
+  }
+  char path[32];
+  iconPath(key, path, sizeof(path));
+  if (!LittleFS.exists(path)) {
+    return nullptr;
+  }
+  File f = LittleFS.open(path, "r");
+  if (!f) {
+    failures++;
+    return nullptr;
+  }
+  if (f.size() != ICON_FILE_BYTES) {
+    f.close();
+    failures++;
+    return nullptr;
+  }
+
+  // Check the name before a RAM slot is given up for the pixels
+  char stored[ICON_KEY_MAX + 1];
+  if (f.read((uint8_t*)stored, sizeof(stored)) != sizeof(stored)) {
+    f.close();
+    failures++;
+    return nullptr;
+  }
+  flashReads++;
+  stored[ICON_KEY_MAX] = '\0';
+  if (name != nullptr && strcmp(stored, name) != 0) {
+    f.close();
+    mismatches++;
+    return nullptr;
+  }
+
+  IconSlot* slot = victimSlot();
+  bool ok = f.read((uint8_t*)slot->pixels, ICON_CACHE_BYTES) == (size_t)ICON_CACHE_BYTES;
+  f.close();
+  if (!ok) {
+    slot->key = 0;
+    failures++;
+    return nullptr;
+  }
+  memcpy(slot->name, stored, sizeof(slot->name));
+  slot->key = key;
+  slot->lastUsed = ++accessClock;
+  return slot;
+}
+
+// ==================== Public API ====================
+void initIconCache() {
+  mounted = LittleFS.begin(true);
+  if (!mounted) {
+    Serial.println("Icon cache: LittleFS mount failed, uploads disabled");
+    return;
+  }
+  LittleFS.mkdir(ICON_CACHE_DIR);
+  Serial.printf("Icon cache: LittleFS %u/%u bytes used\n",
+                (unsigned)LittleFS.usedBytes(), (unsigned)LittleFS.totalBytes());
+}
+
+uint32_t saveAppIcon(const char* app, const uint8_t* pixels) {
+  char name[ICON_KEY_MAX + 1] = {};  // Written whole: zeros after the NUL, not stack bytes
+  int len = normaliseName(app, name);
+  if (len == 0 || !mounted) {
+    saveFailures++;
+    return 0;
+  }
+  uint32_t key = iconKey(name, len);
+
+  // Write a temporary file and rename it over the old one, so a load on the
+  // render task sees either the previous icon or this one, never half of it
+  char path[32];
+  char tmpPath[36];
+  iconPath(key, path, sizeof(path));
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+  File f = LittleFS.open(tmpPath, "w");
+  if (!f) {
+    saveFailures++;
+    return 0;
+  }
+  size_t written = f.write((const uint8_t*)name, sizeof(name));
+  written += f.write(pixels, ICON_CACHE_BYTES);
+  f.close();
+  if (written != (size_t)ICON_FILE_BYTES || !LittleFS.rename(tmpPath, path)) {
+    LittleFS.remove(tmpPath);
+    saveFailures++;
+    return 0;
+  }
+  saves++;
+  return key;
+}
+
+uint32_t cacheAppIcon(const char* app, const uint8_t* pixels) {
+  char name[ICON_KEY_MAX + 1] = {};
+  int len = normaliseName(app, name);
+  if (len == 0) {
+    return 0;
+  }
+  uint32_t key = iconKey(name, len);
+
+  // Replace the RAM copy, so redraws pick up the new icon without a flash read
+  IconSlot* slot = findSlot(key, nullptr);
+  if (slot == nullptr) {
+    slot = victimSlot();
+    slot->key = key;
+    slot->lastUsed = ++accessClock;
+  }
+  memcpy(slot->name, name, sizeof(slot->name));
+  memcpy(slot->pixels, pixels, ICON_CACHE_BYTES);
+  stores++;
+  publishReport();
+  return key;
+}
+
+uint32_t appIconKey(const char* app) {
+  char name[ICON_KEY_MAX + 1];
+  int len = normaliseName(app, name);
+  return len > 0 ? iconKey(name, len) : 0;
+}
+
+// RAM slot for key, loading it from flash on a miss
+static IconSlot* lookupSlot(uint32_t key, const char* name) {
+  IconSlot* slot = findSlot(key, name);
+  if (slot != nullptr) {
+    hits++;
+  } else {
+    misses++;
+    slot = loadSlot(key, name);
+  }
+  publishReport();
+  return slot;
+}
+
+uint32_t findUploadedIcon(const char* app) {
+  char name[ICON_KEY_MAX + 1];
+  int len = normaliseName(app, name);
+  if (len == 0) {
+    return 0;
+  }
+  uint32_t key = iconKey(name, len);
+  return lookupSlot(key, name) != nullptr ? key : 0;
+}
+
+const uint16_t* appIconPixels(uint32_t key) {
+  if (key == 0) {
+    return nullptr;
+  }
+  IconSlot* slot = lookupSlot(key, nullptr);
+  return slot != nullptr ? slot->pixels : nullptr;
+}
+
+// ==================== Reporting ====================
+String iconCacheJson() {
+  IconCacheReport r;
+  report.read(r);
+
+  String out = "{\"ram_slots\":" + String(ICON_CACHE_RAM_SLOTS);
+  out += ",\"ram_used\":" + String(r.ramUsed);
+  out += ",\"hits\":" + String(r.hits);
+  out += ",\"misses\":" + String(r.misses);
+  out += ",\"flash_reads\":" + String(r.flashReads);
+  out += ",\"stores\":" + String(r.stores);
+  out += ",\"saves\":" + String(saves.load());
+  out += ",\"save_failures\":" + String(saveFailures.load());
+  out += ",\"failures\":" + String(r.failures);
+  out += ",\"mismatches\":" + String(r.mismatches);
+  out += ",\"fs_mounted\":" + String(mounted ? "true" : "false");
+  if (mounted) {
+    out += ",\"fs_used_bytes\":" + String((uint32_t)LittleFS.usedBytes());
+    out += ",\"fs_total_bytes\":" + String((uint32_t)LittleFS.totalBytes());
+  }
+  out += "}";
+  return out;
+}
@@ -0,0 +1,50 @@
+#ifndef ICON_CACHE_H
+#define ICON_CACHE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * App icons uploaded at runtime (POST /icon), for apps the built-in atlas
+ * doesn't know. Each icon is a 14x14 RGB565 image in panel byte order
+ * (big-endian pairs, like album art). It is stored on LittleFS as
+ * ICON_CACHE_DIR/<key>.bin, where the key is a hash of the lower-cased app
+ * name, and the most recently used ones are kept in ICON_CACHE_RAM_SLOTS.
+ *
+ * A notification resolves its icon key when stored, which loads the icon
+ * into RAM; draws then read RAM only, unless more distinct icons than RAM
+ * slots are in use.
+ */
+
+static const int ICON_CACHE_BYTES = ICON_WIDTH * ICON_HEIGHT * 2;
+
+// Mount LittleFS (formatting it on first boot)
+void initIconCache();
+
+/**
+ * Write an app's icon to flash, replacing any previous one. Flash writes and
+ * erases can stall for tens of ms, so this runs on the network task (POST
+ * /icon), never the render task.
+ * @param pixels - ICON_CACHE_BYTES in panel byte order
+ * @return the icon key, or 0 if it could not be written
+ */
+uint32_t saveAppIcon(const char* app, const uint8_t* pixels);
+
+// Put an icon just saved with saveAppIcon() in RAM (render task); returns its key
+uint32_t cacheAppIcon(const char* app, const uint8_t* pixels);
+
+// Key an icon for app is stored under (0 for an empty name)
+uint32_t appIconKey(const char* app);
+
+// Key of an uploaded icon for app (loaded into RAM), or 0 if there is none. The
+// name stored with the icon must match, so an app whose name hashes to the same
+// key never gets another app's icon.
+uint32_t findUploadedIcon(const char* app);
+
+// Pixels for an icon key, loading from flash on a RAM miss; nullptr if gone
+const uint16_t* appIconPixels(uint32_t key);
+
+// RAM slots, hits, misses, flash reads, saves and name mismatches, served by /icons
+String iconCacheJson();
+
+#endif
@@ -1,23 +0,0 @@
-// Auto-generated from github.png
-// Dimensions: 14x14
-#pragma once
-#include <Arduino.h>
-
-const uint16_t github_icon_WIDTH = 14;
-const uint16_t github_icon_HEIGHT = 14;
-
-const uint16_t github_icon[196] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2124, 0x39E7, 0x4208, 0x2965, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x8410,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD75, 0xD6BA, 0x8430, 0xA514,
-    0x9CF3, 0x94B2, 0x9CF3, 0xC618, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0xFFFF, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x1082, 0xD6BA, 0x738E, 0x0000, 0x0000, 0x0000, 0x0000, 0x528A, 0xFFFF, 0x94B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB596,
-    0xAD75, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AEB, 0xFFFF, 0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0xBDD7, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4208, 0xFFFF, 0xA534, 0x0020, 0x0000, 0x0000, 0x0000, 0x2945, 0xEF7D, 0x9492, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x10A2, 0xAD55, 0xC618, 0x52AA, 0x0000, 0x0000, 0x52AA, 0xF79E, 0xFFFF, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x7BCF, 0x94B2, 0x0841, 0x0000, 0xA534, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186,
-    0x5AEB, 0x0020, 0x0000, 0x4208, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000
-};
@@ -0,0 +1,69 @@
+// Auto-generated from app_icons.txt by tools/png_to_rgb565.py --atlas
+// 3 bitmaps (1,176 bytes), 10 app names in 16 slots
+#pragma once
+#include <Arduino.h>
+#include "../config.h"
+
+// 14x14 bitmaps back to back, byte-swapped (pushImage order with swap bytes off)
+const uint8_t ICON_ATLAS_COUNT = 3;
+const uint16_t ICON_ATLAS[588] PROGMEM = {
+    0x0000, 0x0000, 0x0000, 0x4200, 0x9C05, 0x7F07, 0x4801, 0x2001, 0x6C07, 0x4A06, 0x8000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xEA01, 0xFF07, 0xFF07, 0x1704, 0xA403, 0xEE07, 0xED07, 0xC302, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xB303, 0xFC05, 0xCF02, 0x0504, 0xEE07, 0xED07, 0xE402, 0x0000, 0x0000, 0x0000, 0x6200, 0x8D02, 0xAE02, 0x6D02, 0xAE02, 0x6D02,
+    0x0100, 0x2604, 0xEE07, 0xED07, 0x8302, 0x0000, 0x0202, 0x4000, 0xDF05, 0xFF07, 0xFF07, 0xDF07, 0xDF07, 0x5F07, 0x8E02, 0x0504,
+    0xEE07, 0xED07, 0xE402, 0xA503, 0xED07, 0xE905, 0x3F07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0x5303, 0x2303, 0xEF07, 0xCD07,
+    0x8302, 0x0A06, 0xF007, 0xAC07, 0x4701, 0x1504, 0x3604, 0x3704, 0x5704, 0x7203, 0x2200, 0x0000, 0x6603, 0xA402, 0x0000, 0xC502,
+    0x2804, 0x4201, 0x0040, 0x00C0, 0x0080, 0x0000, 0x0070, 0x00A0, 0x0008, 0x0008, 0xC08A, 0xA0B3, 0xC0AB, 0xA0AB, 0x60A3, 0xE038,
+    0x03F9, 0xA5F9, 0xC2F8, 0x0070, 0x03F9, 0x65F9, 0x0188, 0x607B, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FE, 0xC2F8, 0x64F9,
+    0x41A8, 0x2080, 0x44F9, 0x65F9, 0x02B8, 0x8062, 0x40FF, 0x80FF, 0x80FF, 0x80FF, 0xC0FF, 0xC0F5, 0x0010, 0x0050, 0x0000, 0x0068,
+    0x44F9, 0x65F9, 0x41B8, 0x0000, 0x6062, 0xA072, 0x6062, 0xA072, 0xA062, 0x8010, 0x0000, 0x0000, 0x0000, 0x2078, 0x44F9, 0x65F9,
+    0x22B8, 0xC06A, 0xC0D5, 0x8093, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0078, 0x44F9, 0x65F9, 0x02A8, 0x209C,
+    0xE0FF, 0xC0FF, 0xE051, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0xC2F8, 0x24F9, 0x0038, 0x6031, 0x20FF, 0xA0E5,
+    0x4010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2421, 0xE739, 0x0842, 0x6529, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA210, 0x1084, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x34A5, 0xC739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x75AD, 0xBAD6, 0x3084, 0x14A5, 0xF39C, 0xB294, 0xF39C, 0x18C6, 0xA210, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0xFFFF, 0x9294,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x8210, 0xBAD6, 0x8E73, 0x0000, 0x0000, 0x0000, 0x0000, 0x8A52, 0xFFFF, 0xB294, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x96B5, 0x75AD, 0x0000, 0x0000, 0x0000, 0x0000, 0xEB5A, 0xFFFF, 0x9294, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x55AD, 0xD7BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0xFFFF, 0x34A5, 0x2000, 0x0000, 0x0000, 0x0000, 0x4529, 0x7DEF,
+    0x9294, 0x0000, 0x0000, 0x0000, 0x0000, 0xA210, 0x55AD, 0x18C6, 0xAA52, 0x0000, 0x0000, 0xAA52, 0x9EF7, 0xFFFF, 0xA631, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF7B, 0xB294, 0x4108, 0x0000, 0x34A5, 0xFFFF, 0xAE73, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x8631, 0xEB5A, 0x2000, 0x0000, 0x0842, 0x694A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBF04, 0x3F05,
+    0xBF04, 0xBF04, 0xBF04, 0xBF04, 0xFF04, 0xBF04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9F04, 0xBF04, 0x5F05, 0xFF04,
+    0xDF04, 0xBF04, 0xBF04, 0xFF04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF05, 0x1F05, 0x1F05, 0xFF04, 0xBF04,
+    0xBF04, 0xBF04, 0x0000, 0x0000, 0x0000, 0xBF04, 0x3F05, 0x9F04, 0x1F04, 0x9F03, 0x3F03, 0x3F03, 0x7F03, 0xDF04, 0xFF04, 0xBF04,
+    0x0000, 0x0000, 0x0000, 0xBF04, 0xFF05, 0x3F05, 0xDF04, 0x5F04, 0xFF03, 0x7F03, 0x1F03, 0xFF04, 0xFF04, 0xBF04, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xFF04, 0x1F05, 0x1F05, 0xBF04, 0x1F04, 0xFF03, 0x3F03, 0xDF04, 0x5F05, 0xBF04, 0xBF04, 0x7F04, 0x1F04, 0xDF03,
+    0x7F03, 0xFF03, 0x1F04, 0x9F04, 0xBF04, 0x5F04, 0x9F03, 0x3F05, 0xFF04, 0x1F05, 0xBF04, 0x5F05, 0xBF04, 0x5F04, 0xDF03, 0x3F03,
+    0x9F02, 0xDF03, 0xFF04, 0xDF04, 0x3F04, 0x0000, 0xFF01, 0xFF04, 0xBF04, 0x5F05, 0x3F05, 0xDF04, 0x3F04, 0xBF03, 0x3F03, 0xBF03,
+    0xFF04, 0x3F05, 0x9F04, 0x0000, 0x0000, 0x0000, 0x0000, 0xBF04, 0xFF04, 0xDF04, 0x7F04, 0x3F04, 0xFF03, 0x5F03, 0xFF04, 0xDF05,
+    0xBF04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBF04, 0xDF04, 0x5F04, 0xBF03, 0x0000, 0xFF04, 0xBF04, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF04, 0x3F05, 0xBF04, 0x1F04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xBF04, 0x5F05, 0x5F05, 0x9F04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x9F04, 0x3F05, 0xDF04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// Slot = appHash(lower-case name, APP_HASH_SEED) & (APP_TABLE_SIZE - 1); every name has its own slot
+const uint32_t APP_HASH_SEED = 0x811C9E0F;
+const uint8_t APP_TABLE_SIZE = 16;
+const AppIconEntry APP_TABLE[APP_TABLE_SIZE] = {
+  {nullptr, APP_NO_BITMAP, 0},
+  {nullptr, APP_NO_BITMAP, 0},
+  {"github", 1, 0},
+  {"pagerduty", APP_NO_BITMAP, COLOR_PAGERDUTY},
+  {nullptr, APP_NO_BITMAP, 0},
+  {"telegram", APP_NO_BITMAP, COLOR_TELEGRAM},
+  {nullptr, APP_NO_BITMAP, 0},
+  {"atlassian", 2, 0},
+  {"whatsapp", APP_NO_BITMAP, COLOR_WHATSAPP},
+  {"slack", 0, 0},
+  {"outlook", APP_NO_BITMAP, COLOR_OUTLOOK},
+  {"discord", APP_NO_BITMAP, COLOR_DISCORD},
+  {"jira", 2, 0},
+  {"teams", APP_NO_BITMAP, COLOR_TEAMS},
+  {nullptr, APP_NO_BITMAP, 0},
+  {nullptr, APP_NO_BITMAP, 0}
+};
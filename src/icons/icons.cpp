@@ -1,52 +1,147 @@
 #include "icons.h"
+#include "../shapes.h"
+#include "../content_canvas.h"
+#include "../icon_cache.h"
+#include "icon_atlas.h"
 
-// ==================== Slack Icon ====================
-void drawSlackIcon(int x, int y) {
-  tft.setSwapBytes(true); // Fix "washed out" or wrong colors for uint16_t arrays
-  tft.pushImage(x, y, ICON_WIDTH, ICON_HEIGHT, slack_icon);
-  tft.setSwapBytes(false); // Reset to avoid affecting other drawing
+// ==================== App Icon Lookup ====================
+static const int APP_NAME_MAX = 31;  // Longer names are cut before matching
+
+static uint32_t appHash(const char* name, int len) {
+  uint32_t h = APP_HASH_SEED;
+  for (int i = 0; i < len; i++) {
+    h = (h ^ (uint8_t)name[i]) * 16777619UL;
+  }
+  return h ^ (h >> 16);
 }
 
-// ==================== GitHub Icon ====================
-void drawGitHubIcon(int x, int y) {
-  tft.setSwapBytes(true);
-  tft.pushImage(x, y, ICON_WIDTH, ICON_HEIGHT, github_icon);
-  tft.setSwapBytes(false);
+// One probe: each known name has a slot of its own
+static uint8_t findAppIcon(const char* name, int len) {
+  uint8_t slot = appHash(name, len) & (APP_TABLE_SIZE - 1);
+  const char* entry = APP_TABLE[slot].name;
+  if (entry != nullptr && strncmp(entry, name, len) == 0 && entry[len] == '\0') {
+    return slot;
+  }
+  return APP_ICON_NONE;
 }
 
-// ==================== Jira Icon ====================
-void drawJiraIcon(int x, int y) {
-  tft.setSwapBytes(true);
-  tft.pushImage(x, y, ICON_WIDTH, ICON_HEIGHT, jira_icon);
-  tft.setSwapBytes(false);
+uint8_t lookupAppIcon(const char* app) {
+  char name[APP_NAME_MAX + 1];
+  int len = 0;
+  while (len < APP_NAME_MAX && app[len] != '\0') {
+    name[len] = tolower(app[len]);
+    len++;
+  }
+  name[len] = '\0';
+
+  uint8_t icon = findAppIcon(name, len);
+
+  // Then word by word: "GitHub Actions", "com.slack.desktop"
+  int start = 0;
+  for (int i = 0; i <= len && icon == APP_ICON_NONE; i++) {
+    if (i == len || !isalnum((unsigned char)name[i])) {
+      if (i > start && i - start < len) {
+        icon = findAppIcon(name + start, i - start);
+      }
+      start = i + 1;
+    }
+  }
+  return icon;
 }
 
-// ==================== App Icon Dispatcher ====================
-void drawAppIcon(int x, int y, String app) {
-  app.toLowerCase();
+// ==================== App Icon Drawing ====================
+void drawAppIcon(int x, int y, uint8_t icon, uint32_t uploadedKey) {
+  TFT_eSPI& canvas = contentCanvas();
+
+  if (icon == APP_ICON_NONE) {
+    const uint16_t* uploaded = appIconPixels(uploadedKey);
+    if (uploaded != nullptr) {
+      drawContentImage(x, y, ICON_WIDTH, ICON_HEIGHT, uploaded);
+      return;
+    }
 
-  if (app.indexOf("slack") >= 0) {
-    drawSlackIcon(x, y);
+    // Default icon
+    canvas.fillRect(x, y, ICON_WIDTH, ICON_HEIGHT, contentInk(COLOR_ICON_DEFAULT));
+    canvas.drawRect(x, y, ICON_WIDTH, ICON_HEIGHT, contentInk(COLOR_ICON_BORDER));
+    contentRecordPush(x, y, ICON_WIDTH, ICON_HEIGHT);
+    return;
   }
-  else if (app.indexOf("github") >= 0) {
-    drawGitHubIcon(x, y);
+
+  const AppIconEntry& entry = APP_TABLE[icon];
+  if (entry.bitmap != APP_NO_BITMAP) {
+    drawContentImage(x, y, ICON_WIDTH, ICON_HEIGHT,
+                     ICON_ATLAS + entry.bitmap * ICON_WIDTH * ICON_HEIGHT);
+  } else {
+    canvas.fillCircle(x + 8, y + 8, 7, contentInk(entry.badgeColor));
+    canvas.drawCircle(x + 8, y + 8, 7, contentInk(COLOR_ICON_BORDER));
+    contentRecordPush(x + 1, y + 1, 15, 15);
   }
-  else if (app.indexOf("jira") >= 0 || app.indexOf("atlassian") >= 0) {
-    drawJiraIcon(x, y);
+}
+
+// ==================== Disc Frame Atlas ====================
+// One row mask per rotation frame (see shapes.h): 64 frames x 15 rows x 2 bytes
+#define DISC_SIZE (DISC_RADIUS * 2 + 1)
+
+static uint16_t discAtlas[DISC_FRAMES][DISC_SIZE];
+static bool discAtlasReady = false;
+
+// Draw one rotation of the disc with primitives (used to build the atlas)
+static void rasteriseDisc(TFT_eSPI& canvas, int cx, int cy, float angle, uint16_t color) {
+  canvas.drawCircle(cx, cy, DISC_RADIUS, color);
+  canvas.fillCircle(cx, cy, DISC_INNER_RADIUS, color);
+
+  // Triangle 1 - pointing outward from center
+  int t1x1 = cx + (int)(3 * cos(angle));
+  int t1y1 = cy + (int)(3 * sin(angle));
+  int t1x2 = cx + (int)(6 * cos(angle - 0.4));
+  int t1y2 = cy + (int)(6 * sin(angle - 0.4));
+  int t1x3 = cx + (int)(6 * cos(angle + 0.4));
+  int t1y3 = cy + (int)(6 * sin(angle + 0.4));
+  canvas.fillTriangle(t1x1, t1y1, t1x2, t1y2, t1x3, t1y3, color);
+
+  // Triangle 2 - opposite side (180 degrees rotated)
+  float angle2 = angle + PI;
+  int t2x1 = cx + (int)(3 * cos(angle2));
+  int t2y1 = cy + (int)(3 * sin(angle2));
+  int t2x2 = cx + (int)(6 * cos(angle2 - 0.4));
+  int t2y2 = cy + (int)(6 * sin(angle2 - 0.4));
+  int t2x3 = cx + (int)(6 * cos(angle2 + 0.4));
+  int t2y3 = cy + (int)(6 * sin(angle2 + 0.4));
+  canvas.fillTriangle(t2x1, t2y1, t2x2, t2y2, t2x3, t2y3, color);
+}
+
+void initDiscAtlas() {
+  if (discAtlasReady) {
+    return;
   }
-  else if (app.indexOf("whatsapp") >= 0) {
-    tft.fillCircle(x + 8, y + 8, 7, COLOR_WHATSAPP);
-    tft.drawCircle(x + 8, y + 8, 7, COLOR_ICON_BORDER);
+
+  TFT_eSprite scratch = TFT_eSprite(&tft);
+  scratch.setColorDepth(1);
+  if (scratch.createSprite(DISC_SIZE, DISC_SIZE) == nullptr) {
+    Serial.println("Disc atlas: sprite alloc failed");
+    return;
   }
-  else if (app.indexOf("telegram") >= 0) {
-    tft.fillCircle(x + 8, y + 8, 7, COLOR_TELEGRAM);
-    tft.drawCircle(x + 8, y + 8, 7, COLOR_ICON_BORDER);
+
+  for (int f = 0; f < DISC_FRAMES; f++) {
+    scratch.fillSprite(TFT_BLACK);
+    float angle = (f * (360.0 / DISC_FRAMES)) * PI / 180.0;
+    rasteriseDisc(scratch, DISC_RADIUS, DISC_RADIUS, angle, TFT_WHITE);
+    packRowMask(scratch, discAtlas[f], DISC_SIZE, DISC_SIZE, TFT_BLACK);
   }
-  else {
-    // Default icon
-    tft.fillRect(x, y, ICON_WIDTH, ICON_HEIGHT, COLOR_ICON_DEFAULT);
-    tft.drawRect(x, y, ICON_WIDTH, ICON_HEIGHT, COLOR_ICON_BORDER);
+
+  scratch.deleteSprite();
+  discAtlasReady = true;
+}
+
+void drawDiscFrame(TFT_eSPI& canvas, int cx, int cy, int frame, uint16_t color) {
+  frame = ((frame % DISC_FRAMES) + DISC_FRAMES) % DISC_FRAMES;
+
+  if (!discAtlasReady) {
+    rasteriseDisc(canvas, cx, cy, (frame * (360.0 / DISC_FRAMES)) * PI / 180.0, color);
+    return;
   }
+
+  drawRowMask(canvas, cx - DISC_RADIUS, cy - DISC_RADIUS, discAtlas[frame], DISC_SIZE, color);
 }
 
 // ==================== Disc Icon (Spinning Triangles) ====================
@@ -54,35 +149,17 @@ void drawDiscIcon(int x, int y, int frame, bool spinning) {
   int cx = x + 8;  // Center X
   int cy = y + 8;  // Center Y
 
-  // Outer circle (outline only)
-  tft.drawCircle(cx, cy, 7, TFT_WHITE);
-
-  // Small center circle
-  tft.fillCircle(cx, cy, 2, TFT_WHITE);
-
   // Spinning triangles - two opposite triangles that rotate based on frame
   if (spinning) {
-    float angle = (frame * 45.0) * PI / 180.0;  // 8 frames: 0, 45, 90, etc.
-
-    // Triangle 1 - pointing outward from center
-    int t1x1 = cx + (int)(3 * cos(angle));
-    int t1y1 = cy + (int)(3 * sin(angle));
-    int t1x2 = cx + (int)(6 * cos(angle - 0.4));
-    int t1y2 = cy + (int)(6 * sin(angle - 0.4));
-    int t1x3 = cx + (int)(6 * cos(angle + 0.4));
-    int t1y3 = cy + (int)(6 * sin(angle + 0.4));
-    tft.fillTriangle(t1x1, t1y1, t1x2, t1y2, t1x3, t1y3, TFT_WHITE);
-
-    // Triangle 2 - opposite side (180 degrees rotated)
-    float angle2 = angle + PI;
-    int t2x1 = cx + (int)(3 * cos(angle2));
-    int t2y1 = cy + (int)(3 * sin(angle2));
-    int t2x2 = cx + (int)(6 * cos(angle2 - 0.4));
-    int t2y2 = cy + (int)(6 * sin(angle2 - 0.4));
-    int t2x3 = cx + (int)(6 * cos(angle2 + 0.4));
-    int t2y3 = cy + (int)(6 * sin(angle2 + 0.4));
-    tft.fillTriangle(t2x1, t2y1, t2x2, t2y2, t2x3, t2y3, TFT_WHITE);
+    // 8 frames: 0, 45, 90, etc. (every 8th atlas frame)
+    drawDiscFrame(tft, cx, cy, frame * (DISC_FRAMES / 8), TFT_WHITE);
   } else {
+    // Outer circle (outline only)
+    tft.drawCircle(cx, cy, DISC_RADIUS, TFT_WHITE);
+
+    // Small center circle
+    tft.fillCircle(cx, cy, DISC_INNER_RADIUS, TFT_WHITE);
+
     // Static triangles when not spinning (at default position)
     tft.fillTriangle(cx + 3, cy, cx + 6, cy - 2, cx + 6, cy + 2, TFT_WHITE);
     tft.fillTriangle(cx - 3, cy, cx - 6, cy - 2, cx - 6, cy + 2, TFT_WHITE);
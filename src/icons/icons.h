@@ -6,21 +6,36 @@
 #include <pgmspace.h>
 #include "../config.h"
 
-// Icon data
-#include "slack_icon.h"
-#include "github_icon.h"
-#include "jira.h"
-
 // External TFT reference
 extern TFT_eSPI tft;
 
-// Draw the appropriate app icon at position
-void drawAppIcon(int x, int y, String app);
+// ==================== App Icons ====================
+/**
+ * App icons come from icon_atlas.h, generated from app_icons.txt by
+ * tools/png_to_rgb565.py --atlas: the bitmaps in one pre-swapped array and
+ * the app names in a perfect-hash table. An app's icon is looked up once,
+ * when its notification is stored; drawing just indexes the table.
+ */
+#define APP_ICON_NONE 0xFF  // No table entry: default square
+#define APP_NO_BITMAP 0xFF  // Entry drawn as a badge circle
+
+struct AppIconEntry {
+  const char* name;     // Lower-case app name, nullptr for an empty slot
+  uint8_t bitmap;       // Index into ICON_ATLAS, or APP_NO_BITMAP
+  uint16_t badgeColor;  // Circle colour when there is no bitmap
+};
+
+// Table slot for an app name (whole name, then each word), or APP_ICON_NONE
+uint8_t lookupAppIcon(const char* app);
+
+// Draw an icon from lookupAppIcon() on the content canvas (canvas coordinates).
+// With no table entry, an uploaded icon (icon_cache.h) is tried before the default square.
+void drawAppIcon(int x, int y, uint8_t icon, uint32_t uploadedKey = 0);
 
-// Individual icon drawers
-void drawSlackIcon(int x, int y);
-void drawGitHubIcon(int x, int y);
-void drawJiraIcon(int x, int y);
 void drawDiscIcon(int x, int y, int frame, bool spinning);
 
+// Spinning disc frame atlas: all DISC_FRAMES rotations rasterised once at boot
+void initDiscAtlas();
+void drawDiscFrame(TFT_eSPI& canvas, int cx, int cy, int frame, uint16_t color);
+
 #endif
@@ -1,23 +0,0 @@
-// Auto-generated from jira.png
-// Dimensions: 14x14
-#pragma once
-#include <Arduino.h>
-
-const uint16_t jira_icon_WIDTH = 14;
-const uint16_t jira_icon_HEIGHT = 14;
-
-const uint16_t jira_icon[196] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04BF, 0x053F, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04FF, 0x04BF, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x049F, 0x04BF, 0x055F, 0x04FF, 0x04DF, 0x04BF, 0x04BF, 0x04FF, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x05DF, 0x051F, 0x051F, 0x04FF, 0x04BF, 0x04BF, 0x04BF, 0x0000, 0x0000, 0x0000, 0x04BF, 0x053F, 0x049F,
-    0x041F, 0x039F, 0x033F, 0x033F, 0x037F, 0x04DF, 0x04FF, 0x04BF, 0x0000, 0x0000, 0x0000, 0x04BF, 0x05FF, 0x053F, 0x04DF, 0x045F,
-    0x03FF, 0x037F, 0x031F, 0x04FF, 0x04FF, 0x04BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x04FF, 0x051F, 0x051F, 0x04BF, 0x041F, 0x03FF,
-    0x033F, 0x04DF, 0x055F, 0x04BF, 0x04BF, 0x047F, 0x041F, 0x03DF, 0x037F, 0x03FF, 0x041F, 0x049F, 0x04BF, 0x045F, 0x039F, 0x053F,
-    0x04FF, 0x051F, 0x04BF, 0x055F, 0x04BF, 0x045F, 0x03DF, 0x033F, 0x029F, 0x03DF, 0x04FF, 0x04DF, 0x043F, 0x0000, 0x01FF, 0x04FF,
-    0x04BF, 0x055F, 0x053F, 0x04DF, 0x043F, 0x03BF, 0x033F, 0x03BF, 0x04FF, 0x053F, 0x049F, 0x0000, 0x0000, 0x0000, 0x0000, 0x04BF,
-    0x04FF, 0x04DF, 0x047F, 0x043F, 0x03FF, 0x035F, 0x04FF, 0x05DF, 0x04BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x04BF, 0x04DF, 0x045F, 0x03BF, 0x0000, 0x04FF, 0x04BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04DF, 0x053F,
-    0x04BF, 0x041F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04BF, 0x055F, 0x055F, 0x049F,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x049F, 0x053F, 0x04DF, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000
-};
@@ -1,23 +0,0 @@
-// Auto-generated from slack_icon.png
-// Dimensions: 14x14
-#pragma once
-#include <Arduino.h>
-
-const uint16_t slack_icon_WIDTH = 14;
-const uint16_t slack_icon_HEIGHT = 14;
-
-const uint16_t slack_icon[196] PROGMEM = {
-    0x0000, 0x0000, 0x0000, 0x0042, 0x059C, 0x077F, 0x0148, 0x0120, 0x076C, 0x064A, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x01EA, 0x07FF, 0x07FF, 0x0417, 0x03A4, 0x07EE, 0x07ED, 0x02C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x03B3, 0x05FC, 0x02CF, 0x0405, 0x07EE, 0x07ED, 0x02E4, 0x0000, 0x0000, 0x0000, 0x0062, 0x028D, 0x02AE, 0x026D, 0x02AE, 0x026D,
-    0x0001, 0x0426, 0x07EE, 0x07ED, 0x0283, 0x0000, 0x0202, 0x0040, 0x05DF, 0x07FF, 0x07FF, 0x07DF, 0x07DF, 0x075F, 0x028E, 0x0405,
-    0x07EE, 0x07ED, 0x02E4, 0x03A5, 0x07ED, 0x05E9, 0x073F, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0353, 0x0323, 0x07EF, 0x07CD,
-    0x0283, 0x060A, 0x07F0, 0x07AC, 0x0147, 0x0415, 0x0436, 0x0437, 0x0457, 0x0372, 0x0022, 0x0000, 0x0366, 0x02A4, 0x0000, 0x02C5,
-    0x0428, 0x0142, 0x4000, 0xC000, 0x8000, 0x0000, 0x7000, 0xA000, 0x0800, 0x0800, 0x8AC0, 0xB3A0, 0xABC0, 0xABA0, 0xA360, 0x38E0,
-    0xF903, 0xF9A5, 0xF8C2, 0x7000, 0xF903, 0xF965, 0x8801, 0x7B60, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFEE0, 0xF8C2, 0xF964,
-    0xA841, 0x8020, 0xF944, 0xF965, 0xB802, 0x6280, 0xFF40, 0xFF80, 0xFF80, 0xFF80, 0xFFC0, 0xF5C0, 0x1000, 0x5000, 0x0000, 0x6800,
-    0xF944, 0xF965, 0xB841, 0x0000, 0x6260, 0x72A0, 0x6260, 0x72A0, 0x62A0, 0x1080, 0x0000, 0x0000, 0x0000, 0x7820, 0xF944, 0xF965,
-    0xB822, 0x6AC0, 0xD5C0, 0x9380, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xF944, 0xF965, 0xA802, 0x9C20,
-    0xFFE0, 0xFFC0, 0x51E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0xF8C2, 0xF924, 0x3800, 0x3160, 0xFF20, 0xE5A0,
-    0x1040, 0x0000, 0x0000, 0x0000
-};
@@ -4,6 +4,12 @@
 
 static Adafruit_NeoPixel strip(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
 
+// Blink state (render task)
+static uint32_t baseColor = 0;     // Colour to come back to
+static int blinkSteps = 0;         // Half-periods left: even = turn off, odd = restore
+static uint16_t blinkStepMs = 0;
+static unsigned long nextBlinkStep = 0;
+
 void initLed() {
   strip.begin();
   strip.setBrightness(50);
@@ -25,24 +31,45 @@ void updateLedForScreen(Screen screen) {
 }
 
 void blinkLed(int times, int delayMs) {
-  uint32_t currentColor = strip.getPixelColor(0);
-  
-  for (int i = 0; i < times; i++) {
-    strip.setPixelColor(0, 0);
-    strip.show();
-    delay(delayMs);
-    strip.setPixelColor(0, currentColor);
+  if (blinkSteps > 0) {
+    return;
+  }
+  baseColor = strip.getPixelColor(0);
+  blinkSteps = times * 2;
+  blinkStepMs = delayMs;
+  nextBlinkStep = millis();
+  ledTick();
+}
+
+void ledTick() {
+  unsigned long now = millis();
+  while (blinkSteps > 0 && (long)(now - nextBlinkStep) >= 0) {
+    strip.setPixelColor(0, blinkSteps % 2 == 0 ? 0 : baseColor);
     strip.show();
-    delay(delayMs);
+    blinkSteps--;
+    nextBlinkStep += blinkStepMs;
   }
 }
 
+uint32_t ledWaitMs() {
+  if (blinkSteps == 0) {
+    return UINT32_MAX;
+  }
+  long wait = (long)(nextBlinkStep - millis());
+  return wait > 0 ? wait : 0;
+}
+
 void setLedColor(uint8_t r, uint8_t g, uint8_t b) {
-  strip.setPixelColor(0, strip.Color(r, g, b));
-  strip.show();
+  // During a blink, the colour it comes back to
+  baseColor = strip.Color(r, g, b);
+  if (blinkSteps % 2 == 0) {
+    strip.setPixelColor(0, baseColor);
+    strip.show();
+  }
 }
 
 void ledOff() {
+  blinkSteps = 0;
   strip.setPixelColor(0, 0);
   strip.show();
 }
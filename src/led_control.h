@@ -6,7 +6,11 @@
 
 void initLed();
 void updateLedForScreen(Screen screen);
+// Blink off and back on, stepped by ledTick() rather than delay(); a blink
+// already running is not restarted, so a burst blinks once
 void blinkLed(int times, int delayMs);
+void ledTick();           // Render task
+uint32_t ledWaitMs();     // Until the next blink step, UINT32_MAX if none
 void setLedColor(uint8_t r, uint8_t g, uint8_t b);
 void ledOff();
 
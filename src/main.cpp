@@ -18,6 +18,13 @@
 #include "api_handlers.h"
 #include "notif_screen.h"
 #include "reminder_screen.h"
+#include "render_metrics.h"
+#include "frame_scheduler.h"
+#include "sprite_pool.h"
+#include "icon_cache.h"
+#include "tasks.h"
+#include "power.h"
+#include "reminder_snapshot.h"
 
 // ==================== Setup ====================
 void setup() {
@@ -31,10 +38,13 @@ void setup() {
   initScreen();
   initState();
   initStorage();  // Load persisted reminders
+  initReminderSnapshot();  // Publish them for API handlers
+  initIconCache();  // Mount LittleFS for uploaded app icons
 
   // Network (shows status on screen)
   initWiFi();
   initNTP();
+  initPower();  // After initWiFi(), which turns modem sleep off
 
   // Start HTTP server
   setupApiRoutes();
@@ -42,46 +52,14 @@ void setup() {
   // Initial screen draw
   setAllZonesDirty();
   refreshScreen();
+  initFrameScheduler();
+  startTasks();
 
   Serial.println("Notification Center ready!");
 }
 
 // ==================== Loop ====================
 void loop() {
-  // Update clock every second
-  static unsigned long lastClock = 0;
-  if (millis() - lastClock > CLOCK_UPDATE_INTERVAL) {
-    updateClock();
-    lastClock = millis();
-  }
-
-  // Check reminders
-  checkReminders();
-
-  // Refresh reminder screen periodically (for countdown updates)
-  static unsigned long lastReminderRefresh = 0;
-  if (currentScreen == SCREEN_REMINDER && millis() - lastReminderRefresh > REMINDER_REFRESH_INTERVAL) {
-    setAllContentDirty();
-    lastReminderRefresh = millis();
-  }
-
-  // Update now playing scrolling ticker
-  updateNowPlayingTicker();
-
-  // Refresh dirty zones
-  refreshScreen();
-
-  // DEBUG: Draw zone boundaries (comment out when done)
-  // drawDebugZones();
-
-  // WiFi reconnect check
-  checkWiFiReconnect();
-
-  // Check physical buttons
-  checkButtons();
-
-  // Check rotary encoder
-  checkEncoder();
-
-  yield();
+  // Everything runs in the tasks from startTasks() (see tasks.h)
+  runTasksFromLoop();
 }
@@ -0,0 +1,186 @@
+#include "notif_history.h"
+#include <atomic>
+#include "config.h"
+#include "icon_cache.h"
+
+static_assert(NOTIF_HISTORY_BYTES <= 65536, "Record offsets are 16-bit");
+static_assert(sizeof(HistoryRecord) % 4 == 0, "Records must stay word-aligned");
+
+alignas(4) static uint8_t logBuf[NOTIF_HISTORY_BYTES];
+static uint16_t offsets[NOTIF_HISTORY_MAX_ENTRIES];  // Ring of record offsets
+static int newest = NOTIF_HISTORY_MAX_ENTRIES - 1;    // Index slot of the newest record
+static int count = 0;
+static uint32_t tail = 0;  // End of the newest record: where the next one goes
+
+// Counters
+static uint32_t appended = 0;
+static uint32_t dropped = 0;
+static uint32_t rewrites = 0;  // Merges that replaced the newest record
+
+// Totals for GET /history. The log belongs to the render task, so it publishes
+// these after each append behind a seqlock (as pc_stats.h does) for the
+// AsyncTCP task to read.
+struct HistoryStats {
+  uint32_t entries;
+  uint32_t bytesUsed;  // Oldest record to the tail, including the unused end after a wrap
+  uint32_t appended;
+  uint32_t dropped;
+  uint32_t rewrites;
+  uint32_t oldestId;
+  uint32_t newestId;
+};
+static const int STATS_WORDS = sizeof(HistoryStats) / sizeof(uint32_t);
+static std::atomic<uint32_t> statsSequence(0);  // Odd while the render task is storing words
+static std::atomic<uint32_t> statsWords[STATS_WORDS];
+
+static HistoryRecord* recordAt(uint16_t offset) {
+  return (HistoryRecord*)(logBuf + offset);
+}
+
+static uint16_t oldestOffset() {
+  return offsets[(newest - count + 1 + NOTIF_HISTORY_MAX_ENTRIES) % NOTIF_HISTORY_MAX_ENTRIES];
+}
+
+static void dropOldest() {
+  count--;
+  dropped++;
+}
+
+static void publishStats() {
+  HistoryStats s = {};
+  s.entries = count;
+  if (count > 0) {
+    uint16_t o = oldestOffset();
+    s.bytesUsed = o < tail ? tail - o : NOTIF_HISTORY_BYTES - o + tail;
+    s.oldestId = notifHistoryAt(count - 1)->id;
+    s.newestId = notifHistoryAt(0)->id;
+  }
+  s.appended = appended;
+  s.dropped = dropped;
+  s.rewrites = rewrites;
+
+  uint32_t src[STATS_WORDS];
+  memcpy(src, &s, sizeof(src));
+  uint32_t seq = statsSequence.load(std::memory_order_relaxed);
+  statsSequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);  // Odd before any word
+  for (int i = 0; i < STATS_WORDS; i++) {
+    statsWords[i].store(src[i], std::memory_order_relaxed);
+  }
+  statsSequence.store(seq + 2, std::memory_order_release);  // Words before even
+}
+
+static void readStats(HistoryStats& out) {
+  uint32_t dst[STATS_WORDS];
+  for (;;) {
+    uint32_t before = statsSequence.load(std::memory_order_acquire);
+    if ((before & 1) == 0) {
+      for (int i = 0; i < STATS_WORDS; i++) {
+        dst[i] = statsWords[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);  // Words before the re-check
+      if (statsSequence.load(std::memory_order_relaxed) == before) {
+        break;
+      }
+    }
+  }
+  memcpy(&out, dst, sizeof(out));
+}
+
+// ==================== Append ====================
+void appendNotifHistory(const Notification& n, uint32_t supersedes) {
+  // A merge into the newest record takes its place
+  if (supersedes != 0 && count > 0 && recordAt(offsets[newest])->id == supersedes) {
+    tail = offsets[newest];
+    newest = (newest + NOTIF_HISTORY_MAX_ENTRIES - 1) % NOTIF_HISTORY_MAX_ENTRIES;
+    count--;
+    rewrites++;
+  }
+
+  size_t appLen = strlen(n.app) + 1;
+  size_t fromLen = strlen(n.from) + 1;
+  size_t msgLen = strlen(n.message) + 1;
+  uint32_t size = (sizeof(HistoryRecord) + appLen + fromLen + msgLen + 3) & ~3u;
+
+  // A record never wraps around the end; the rest of the buffer is left unused
+  uint32_t start = tail;
+  if (start + size > NOTIF_HISTORY_BYTES) {
+    // Records past the old tail are the oldest ones; they go first
+    while (count > 0 && oldestOffset() >= tail) {
+      dropOldest();
+    }
+    start = 0;
+  }
+  // Then whatever the new record overlaps, oldest first
+  while (count > 0) {
+    uint16_t o = oldestOffset();
+    if (o >= start + size || o + recordAt(o)->size <= start) {
+      break;
+    }
+    dropOldest();
+  }
+  if (count == NOTIF_HISTORY_MAX_ENTRIES) {
+    dropOldest();
+  }
+
+  HistoryRecord* r = recordAt(start);
+  r->id = n.id;
+  r->iconKey = n.iconKey;
+  r->size = size;
+  r->color = n.color;
+  r->icon = n.icon;
+  r->fromAt = appLen;
+  r->messageAt = appLen + fromLen;
+  r->count = min<uint16_t>(n.count, 255);
+  char* text = (char*)(r + 1);
+  memcpy(text, n.app, appLen);
+  memcpy(text + appLen, n.from, fromLen);
+  memcpy(text + appLen + fromLen, n.message, msgLen);
+
+  newest = (newest + 1) % NOTIF_HISTORY_MAX_ENTRIES;
+  offsets[newest] = start;
+  count++;
+  tail = start + size;
+  appended++;
+  publishStats();
+}
+
+// ==================== Lookup ====================
+int notifHistoryCount() {
+  return count;
+}
+
+const HistoryRecord* notifHistoryAt(int age) {
+  if (age < 0 || age >= count) {
+    return nullptr;
+  }
+  return recordAt(offsets[(newest - age + NOTIF_HISTORY_MAX_ENTRIES) % NOTIF_HISTORY_MAX_ENTRIES]);
+}
+
+void refreshNotifHistoryIcons(uint32_t key) {
+  for (int age = 0; age < count; age++) {
+    HistoryRecord* r = (HistoryRecord*)notifHistoryAt(age);
+    if (r->icon == APP_ICON_NONE && appIconKey(historyApp(r)) == key) {
+      r->iconKey = key;
+    }
+  }
+}
+
+// ==================== Reporting ====================
+String notifHistoryJson() {
+  HistoryStats s;
+  readStats(s);
+
+  String out = "{\"entries\":" + String(s.entries);
+  out += ",\"max_entries\":" + String(NOTIF_HISTORY_MAX_ENTRIES);
+  out += ",\"bytes_used\":" + String(s.bytesUsed);
+  out += ",\"bytes\":" + String(NOTIF_HISTORY_BYTES);
+  out += ",\"avg_record_bytes\":" + String(s.entries > 0 ? s.bytesUsed / s.entries : 0);
+  out += ",\"appended\":" + String(s.appended);
+  out += ",\"dropped\":" + String(s.dropped);
+  out += ",\"rewrites\":" + String(s.rewrites);
+  out += ",\"oldest_id\":" + String(s.oldestId);
+  out += ",\"newest_id\":" + String(s.newestId);
+  out += "}";
+  return out;
+}
@@ -0,0 +1,51 @@
+#ifndef NOTIF_HISTORY_H
+#define NOTIF_HISTORY_H
+
+#include <Arduino.h>
+#include "types.h"
+
+/**
+ * Log of past notifications, kept after they scroll off the screen or are
+ * cleared. Records are packed into one NOTIF_HISTORY_BYTES buffer: a small
+ * header followed by the app, sender and message text, each NUL-terminated,
+ * so a record is only as long as its text. New records go after the newest;
+ * the oldest are dropped to make room. An index of record offsets gives any
+ * entry by age without walking the buffer, and the text pointers handed out
+ * point into the record, so paging draws straight from the log.
+ */
+
+struct HistoryRecord {
+  uint32_t id;         // Same id as the Notification it was stored from
+  uint32_t iconKey;
+  uint16_t size;       // Header + text, rounded up to 4 bytes
+  uint16_t color;
+  uint8_t icon;
+  uint8_t fromAt;      // Text offsets; app starts at 0
+  uint8_t messageAt;
+  uint8_t count;       // Notification count, capped at 255
+  // Followed by app, from and message text
+};
+
+// Append n as the newest record (render task, which owns notifications). If the
+// newest record has id supersedes (n merged into it), it is rewritten instead
+void appendNotifHistory(const Notification& n, uint32_t supersedes = 0);
+
+// Entries stored
+int notifHistoryCount();
+
+// Newest first: notifHistoryAt(0) is the latest; nullptr past the oldest
+const HistoryRecord* notifHistoryAt(int age);
+
+// Record text, pointing into the log
+inline const char* historyApp(const HistoryRecord* r) { return (const char*)(r + 1); }
+inline const char* historyFrom(const HistoryRecord* r) { return historyApp(r) + r->fromAt; }
+inline const char* historyMessage(const HistoryRecord* r) { return historyApp(r) + r->messageAt; }
+
+// Point records without an icon from the app stored under key at it (after POST /icon)
+void refreshNotifHistoryIcons(uint32_t key);
+
+// Entries, bytes used and dropped records as last published by the render task (any task),
+// served by GET /history
+String notifHistoryJson();
+
+#endif
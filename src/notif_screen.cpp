@@ -3,104 +3,489 @@
 #include "config.h"
 #include "screen.h"
 #include "led_control.h"
+#include "render_metrics.h"
+#include "shapes.h"
+#include "text_layout.h"
+#include "sprite_pool.h"
+#include "content_canvas.h"
+#include "icon_cache.h"
+#include "notif_history.h"
 #include "icons/icons.h"
 #include "fonts/MDIOTrial_Regular8pt7b.h"
 #include "fonts/MDIOTrial_Bold8pt7b.h"
 
+// ==================== Slot Cache ====================
+/**
+ * Each visible notification's text is rasterised once into a 1-bit mask keyed
+ * by its id: the sender line above SLOT_MSG_ROW, the message lines below it.
+ * When a new notification arrives the others move down a slot and are redrawn
+ * from their masks, so only the new arrival goes through the font renderer.
+ */
+static const int NOTIF_SLOTS = 3;  // Only 3 visible slots on screen
+static const int SLOT_MASK_W = TFT_WIDTH;
+static const int SLOT_MASK_H = 60;    // Zone height minus the 5px top padding
+static const int SLOT_MASK_STRIDE = (SLOT_MASK_W + 7) / 8;
+static const int SLOT_MSG_ROW = 20;   // First message line; rows above hold the sender
+
+struct NotifSlotCache {
+  uint32_t id;  // Notification id, 0 = unused
+  int16_t senderW;
+  int16_t line1W;
+  int16_t line2W;  // 0 when the message fits on one line
+  int16_t badgeW;  // 0 without a count badge
+  uint8_t mask[SLOT_MASK_H * SLOT_MASK_STRIDE];
+};
+
+static NotifSlotCache slotCache[NOTIF_SLOTS];
+static uint32_t nextNotifId = 1;
+
+// ==================== Coalescing ====================
+/**
+ * Repeats from the same app and sender within NOTIF_COALESCE_WINDOW_MS merge
+ * into their entry instead of pushing the list down: the message becomes the
+ * latest, a badge shows the count, and the entry keeps its place. Only the
+ * first of a burst blinks the LED. Every arrival also restarts the repaint
+ * hold, so the frame scheduler draws a burst once it settles.
+ */
+static const int BADGE_PAD = 4;  // Badge text inset
+
+static uint32_t received = 0;      // addNotification() calls
+static uint32_t displayed = 0;     // Arrivals that became a new entry
+static uint32_t merged = 0;        // Arrivals merged into an entry
+static uint32_t repaints = 0;      // drawNotifContent() passes
+static unsigned long burstStart = 0;
+static unsigned long lastArrival = 0;
+static bool holding = false;       // A burst is settling
+
+uint32_t notifRepaintHoldMs() {
+  if (!holding) {
+    return 0;
+  }
+  unsigned long now = millis();
+  long quiet = (long)(lastArrival + NOTIF_RENDER_DEBOUNCE_MS - now);
+  long cap = (long)(burstStart + NOTIF_RENDER_MAX_HOLD_MS - now);
+  long hold = min(quiet, cap);
+  if (hold <= 0) {
+    holding = false;
+    return 0;
+  }
+  return hold;
+}
+
+static void noteArrival() {
+  unsigned long now = millis();
+  received++;
+  if (NOTIF_RENDER_DEBOUNCE_MS == 0) {
+    return;
+  }
+  if (!holding) {
+    holding = true;
+    burstStart = now;
+  }
+  lastArrival = now;
+}
+
+// On-screen entry from the same app and sender within the window, or -1.
+// Entries past NOTIF_SLOTS are not searched: a merge there would be invisible.
+static int findCoalesceAge(const char* app, const char* from) {
+  if (NOTIF_COALESCE_WINDOW_MS == 0) {
+    return -1;
+  }
+  for (int age = 0; age < NOTIF_SLOTS; age++) {
+    const Notification& n = notificationAt(age);
+    if (n.id != 0 && millis() - n.updated <= NOTIF_COALESCE_WINDOW_MS &&
+        strcmp(n.app, app) == 0 && strcmp(n.from, from) == 0) {
+      return age;
+    }
+  }
+  return -1;
+}
+
+// ==================== History Paging ====================
+// Page 0 is the live list; page p > 0 shows the history records not on page 0
+// (scrolled off, merged over or cleared), from past index (p - 1) * NOTIF_SLOTS
+static int historyPage = 0;
+static unsigned long lastPageInput = 0;
+
+static bool onLivePage(uint32_t id) {
+  for (int age = 0; age < NOTIF_SLOTS; age++) {
+    if (notificationAt(age).id == id) return true;
+  }
+  return false;
+}
+
+// index-th history record not on the live page, newest first; nullptr past the oldest
+static const HistoryRecord* pastRecordAt(int index) {
+  for (int age = 0; age < notifHistoryCount(); age++) {
+    const HistoryRecord* r = notifHistoryAt(age);
+    if (!onLivePage(r->id) && index-- == 0) {
+      return r;
+    }
+  }
+  return nullptr;
+}
+
+static int pastRecordCount() {
+  int past = 0;
+  for (int age = 0; age < notifHistoryCount(); age++) {
+    if (!onLivePage(notifHistoryAt(age)->id)) past++;
+  }
+  return past;
+}
+
+// What a slot shows, from the live list or straight from a history record
+struct SlotView {
+  uint32_t id;  // 0 = empty slot
+  uint8_t icon;
+  uint32_t iconKey;
+  uint16_t color;
+  uint16_t count;
+  const char* from;
+  const char* message;
+};
+
+static SlotView slotViewAt(int slot) {
+  SlotView v = {0, APP_ICON_NONE, 0, TFT_WHITE, 0, "", ""};
+  if (historyPage == 0) {
+    const Notification& n = notificationAt(slot);
+    if (n.message[0] != '\0') {
+      v = {n.id, n.icon, n.iconKey, n.color, n.count, n.from, n.message};
+    }
+  } else {
+    const HistoryRecord* r = pastRecordAt((historyPage - 1) * NOTIF_SLOTS + slot);
+    if (r != nullptr) {
+      v = {r->id, r->icon, r->iconKey, r->color, r->count, historyFrom(r), historyMessage(r)};
+    }
+  }
+  return v;
+}
+
+static int historyPages() {
+  return (pastRecordCount() + NOTIF_SLOTS - 1) / NOTIF_SLOTS;
+}
+
+static void setHistoryPage(int page) {
+  lastPageInput = millis();
+  if (page == historyPage) {
+    return;
+  }
+  historyPage = page;
+  setZoneDirty(ZONE_TITLE);
+  setAllContentDirty();
+}
+
+void pageNotifHistory(int step, bool wrap) {
+  if (currentScreen != SCREEN_NOTIFS) {
+    currentScreen = SCREEN_NOTIFS;
+    setZoneDirty(ZONE_TITLE);
+    setAllContentDirty();
+  }
+  int page = historyPage + step;
+  int last = historyPages();
+  if (page > last) {
+    page = wrap ? 0 : last;
+  }
+  setHistoryPage(max(page, 0));
+}
+
+void showLatestNotifs() {
+  setHistoryPage(0);
+}
+
+bool browsingNotifHistory() {
+  return historyPage > 0;
+}
+
+int notifTitle(char* buf, size_t size) {
+  if (historyPage == 0) {
+    return snprintf(buf, size, "NOTIFS");
+  }
+  return snprintf(buf, size, "H%d/%d", historyPage, historyPages());  // Fits the title zone up to "H171/171"
+}
+
+void notifHistoryTick() {
+  if (historyPage > 0 && millis() - lastPageInput >= NOTIF_HISTORY_PAGE_TIMEOUT_MS) {
+    showLatestNotifs();
+  }
+}
+
+// ==================== Slot Text ====================
+// Draw sender and message text with the slot's top-left text row at y
+static void drawSlotText(TFT_eSPI& canvas, const SlotView& n, int y,
+                         uint16_t senderColor, uint16_t msgColor,
+                         int16_t* senderW, int16_t* line1W, int16_t* line2W, int16_t* badgeW) {
+  canvas.setTextSize(1);
+
+  // Count badge (Regular), an outlined tag at the right end of the sender row
+  int senderMaxW = NOTIF_SENDER_MAX_W;
+  *badgeW = 0;
+  if (n.count > 1) {
+    char badge[8];
+    if (n.count > 99) {
+      strcpy(badge, "99+");
+    } else {
+      snprintf(badge, sizeof(badge), "x%d", n.count);
+    }
+    canvas.setFreeFont(&MDIOTrial_Regular8pt7b);
+    canvas.setTextColor(senderColor);
+    *badgeW = canvas.textWidth(badge) + 2 * BADGE_PAD;
+    int badgeX = SLOT_MASK_W - 5 - *badgeW;
+    canvas.drawRoundRect(badgeX, y, *badgeW, SLOT_MSG_ROW - 2, 4, senderColor);
+    canvas.drawString(badge, badgeX + BADGE_PAD, y + 1);
+    senderMaxW = min(senderMaxW, badgeX - BADGE_PAD - 27 - canvas.textWidth(":"));
+  }
+
+  // Sender (Bold), cut to fit before the ":"
+  canvas.setFreeFont(&MDIOTrial_Bold8pt7b);
+  canvas.setTextColor(senderColor);
+  TextLine senderLine;
+  char sender[LAYOUT_MAX_LINE_CHARS + 2];
+  int senderLen = 0;
+  if (layoutFit(FONT_BOLD_8, n.from, senderMaxW, &senderLine)) {
+    senderLen = layoutCopyLine(n.from, senderLine, sender, sizeof(sender) - 1);
+  }
+  strcpy(sender + senderLen, ":");
+  *senderW = canvas.drawString(sender, 27, y);
+
+  // Message (Regular), word-wrapped by pixel width
+  canvas.setFreeFont(&MDIOTrial_Regular8pt7b);
+  canvas.setTextColor(msgColor);
+  TextLine lines[CONTENT_TEXT_LINES];
+  int lineCount = layoutWrap(FONT_REGULAR_8, n.message, CONTENT_TEXT_MAX_W,
+                             lines, CONTENT_TEXT_LINES);
+  int16_t* widths[] = {line1W, line2W};
+  for (int l = 0; l < 2; l++) {
+    *widths[l] = l < lineCount
+                   ? drawTextLine(canvas, n.message, lines[l], 5, y + SLOT_MSG_ROW * (l + 1))
+                   : 0;
+  }
+}
+
+static NotifSlotCache* findSlotCache(uint32_t id) {
+  for (int c = 0; c < NOTIF_SLOTS; c++) {
+    if (slotCache[c].id == id) {
+      return &slotCache[c];
+    }
+  }
+  return nullptr;
+}
+
+// Rasterise n into an entry not used by any of the visible slots
+static NotifSlotCache* renderSlotCache(const SlotView& n, const SlotView visible[NOTIF_SLOTS]) {
+  NotifSlotCache* entry = nullptr;
+  for (int c = 0; c < NOTIF_SLOTS && entry == nullptr; c++) {
+    bool shown = false;
+    for (int i = 0; i < NOTIF_SLOTS; i++) {
+      if (visible[i].id != 0 && visible[i].id == slotCache[c].id) {
+        shown = true;
+      }
+    }
+    if (!shown) {
+      entry = &slotCache[c];
+    }
+  }
+  if (entry == nullptr) {
+    return nullptr;
+  }
+
+  TFT_eSprite* scratch = leaseSprite(SPRITE_OWNER_SCRATCH, SLOT_MASK_W, SLOT_MASK_H, 1);
+  if (scratch == nullptr) {
+    Serial.println("Notif cache: sprite alloc failed, drawing text directly");
+    return nullptr;
+  }
+  scratch->fillSprite(TFT_BLACK);
+  drawSlotText(*scratch, n, 0, TFT_WHITE, TFT_WHITE,
+               &entry->senderW, &entry->line1W, &entry->line2W, &entry->badgeW);
+  memcpy(entry->mask, scratch->getPointer(), sizeof(entry->mask));
+  releaseSprite(scratch);
+
+  entry->id = n.id;
+  return entry;
+}
+
 // ==================== Draw Content ====================
 void drawNotifContent() {
-  tft.setTextSize(1);
+  repaints++;
+  TFT_eSPI& canvas = contentCanvas();
+  int originY = contentOriginY();
 
-  // Y start positions for each notification slot (only 3 visible slots)
+  // Y start positions for each notification slot
   const int slotYStarts[] = {ZONE_CONTENT1_Y_START, ZONE_CONTENT2_Y_START, ZONE_CONTENT3_Y_START};
-  const int numSlots = 3;  // Only 3 visible slots on screen
 
-  for (int i = 0; i < min(MAX_NOTIFICATIONS, numSlots); i++) {
-    int y = slotYStarts[i] + 5;  // 3px padding from zone top
+  SlotView views[NOTIF_SLOTS];
+  for (int i = 0; i < NOTIF_SLOTS; i++) {
+    views[i] = slotViewAt(i);
+  }
+
+  for (int i = 0; i < min(MAX_NOTIFICATIONS, NOTIF_SLOTS); i++) {
+    int y = slotYStarts[i] + 5 - originY;  // 5px padding from zone top
+    const SlotView& n = views[i];
 
-    if (notifications[i].message != "") {
+    if (n.id != 0) {
       // Draw app icon
-      drawAppIcon(4, y, notifications[i].app);
+      drawAppIcon(4, y, n.icon, n.iconKey);
 
-      // Draw sender (Bold)
-      tft.setFreeFont(&MDIOTrial_Bold8pt7b);
-      tft.setTextColor(notifications[i].color);
-      String sender = notifications[i].from;
-      if (sender.length() > NOTIF_SENDER_MAX_CHARS) {
-        sender = sender.substring(0, NOTIF_SENDER_MAX_CHARS);
+      int16_t senderW, line1W, line2W, badgeW;
+      NotifSlotCache* cached = findSlotCache(n.id);
+      if (cached == nullptr) {
+        cached = renderSlotCache(n, views);
       }
-      tft.drawString(sender + ":", 27, y);
 
-      // Draw message (Regular)
-      tft.setFreeFont(&MDIOTrial_Regular8pt7b);
-      tft.setTextColor(COLOR_NOTIF_MSG);
-      String msg = notifications[i].message;
-      if (msg.length() > NOTIF_MSG_MAX_CHARS - 1) {
-        msg = msg.substring(0, NOTIF_MSG_MAX_CHARS - 1) + "...";
+      if (cached != nullptr) {
+        drawBitMask(canvas, 0, y, cached->mask, SLOT_MASK_STRIDE, SLOT_MASK_W, SLOT_MSG_ROW,
+                    contentInk(n.color));
+        drawBitMask(canvas, 0, y + SLOT_MSG_ROW, cached->mask + SLOT_MSG_ROW * SLOT_MASK_STRIDE,
+                    SLOT_MASK_STRIDE, SLOT_MASK_W, SLOT_MASK_H - SLOT_MSG_ROW,
+                    contentInk(COLOR_NOTIF_MSG));
+        senderW = cached->senderW;
+        line1W = cached->line1W;
+        line2W = cached->line2W;
+        badgeW = cached->badgeW;
+      } else {
+        drawSlotText(canvas, n, y, contentInk(n.color), contentInk(COLOR_NOTIF_MSG),
+                     &senderW, &line1W, &line2W, &badgeW);
       }
 
-      // Line 1
-      String msgLine1 = msg.substring(0, min(NOTIF_MSG_LINE_CHARS, (int)msg.length()));
-      msgLine1.trim();
-      tft.drawString(msgLine1, 5, y + 20);
-
-      // Line 2
-      if (msg.length() > NOTIF_MSG_LINE_CHARS) {
-        String msgLine2 = msg.substring(NOTIF_MSG_LINE_CHARS);
-        msgLine2.trim();
-        tft.drawString(msgLine2, 5, y + 40);
+      // Drawn straight to the TFT (no canvas): record the text bounding boxes
+      tft.setFreeFont(&MDIOTrial_Bold8pt7b);
+      contentRecordPush(27, y, senderW, tft.fontHeight());
+      if (badgeW > 0) {
+        contentRecordPush(SLOT_MASK_W - 5 - badgeW, y, badgeW, SLOT_MSG_ROW - 2);
+      }
+      tft.setFreeFont(&MDIOTrial_Regular8pt7b);
+      contentRecordPush(5, y + SLOT_MSG_ROW, line1W, tft.fontHeight());
+      if (line2W > 0) {
+        contentRecordPush(5, y + SLOT_MSG_ROW * 2, line2W, tft.fontHeight());
       }
     }
   }
 }
 
+// ==================== Notification Ring ====================
+const Notification& notificationAt(int age) {
+  return notifications[(notifHead + age) % MAX_NOTIFICATIONS];
+}
+
 // ==================== Add Notification ====================
-void addNotification(String app, String from, String msg, uint16_t color) {
-  // Shift existing notifications down
-  for (int i = MAX_NOTIFICATIONS - 1; i > 0; i--) {
-    notifications[i] = notifications[i - 1];
+void addNotification(const char* app, const char* from, const char* msg, uint16_t color) {
+  noteArrival();
+
+  // Compare as stored, so names cut to the same text still match
+  char appKey[NOTIF_APP_MAX_CHARS + 1];
+  char fromKey[NOTIF_SENDER_MAX_CHARS + 1];
+  textCopy(appKey, sizeof(appKey), textSlice(app));
+  textCopy(fromKey, sizeof(fromKey), textSlice(from));
+
+  int age = findCoalesceAge(appKey, fromKey);
+  if (age >= 0) {
+    Notification& n = notifications[(notifHead + age) % MAX_NOTIFICATIONS];
+    uint32_t oldId = n.id;
+    n.id = nextNotifId++;  // New text, so a new cached slot
+    textCopy(n.message, sizeof(n.message), textSlice(msg));
+    n.color = color;
+    if (n.count < UINT16_MAX) n.count++;
+    n.updated = millis();
+    appendNotifHistory(n, oldId);
+    merged++;
+
+    // Only its slot changes; a history page may have shifted
+    if (currentScreen == SCREEN_NOTIFS) {
+      if (historyPage > 0) {
+        setAllContentDirty();
+      } else {
+        setZoneDirty((Zone)(ZONE_CONTENT1 + age));
+      }
+    }
+    return;
   }
 
-  // Add new notification at top
-  notifications[0].app = app;
-  notifications[0].from = from;
-  notifications[0].message = msg.substring(0, NOTIF_MSG_MAX_CHARS);
-  notifications[0].color = color;
+  // Step the head back over the oldest entry, which the new one replaces
+  notifHead = (notifHead + MAX_NOTIFICATIONS - 1) % MAX_NOTIFICATIONS;
+  Notification& n = notifications[notifHead];
+
+  // A fresh id, so it gets its own cached slot
+  n.id = nextNotifId++;
+  strcpy(n.app, appKey);
+  strcpy(n.from, fromKey);
+  textCopy(n.message, sizeof(n.message), textSlice(msg));
+  n.icon = lookupAppIcon(n.app);
+  n.iconKey = n.icon == APP_ICON_NONE ? findUploadedIcon(n.app) : 0;
+  n.color = color;
+  n.count = 1;
+  n.updated = millis();
+  appendNotifHistory(n);
+  displayed++;
 
   // Update LED and screen
   updateLedForScreen(SCREEN_NOTIFS);
   blinkLed(2, 100);  // Blink twice on new notification
 
-  // Switch to notifications screen
+  // Switch to notifications screen, showing the latest
   currentScreen = SCREEN_NOTIFS;
+  historyPage = 0;
   setZoneDirty(ZONE_TITLE);
   setAllContentDirty();
 }
 
+// ==================== Uploaded Icons ====================
+void refreshNotificationIcons(uint32_t key) {
+  for (int i = 0; i < MAX_NOTIFICATIONS; i++) {
+    Notification& n = notifications[i];
+    if (n.id != 0 && n.icon == APP_ICON_NONE && appIconKey(n.app) == key) {
+      n.iconKey = key;
+    }
+  }
+  refreshNotifHistoryIcons(key);
+  if (currentScreen == SCREEN_NOTIFS) {
+    setAllContentDirty();
+  }
+}
+
 // ==================== Clear All ====================
+// The history keeps them
 void clearAllNotifications() {
   for (int i = 0; i < MAX_NOTIFICATIONS; i++) {
     notifications[i] = Notification();
   }
+  notifHead = 0;
   ledOff();
   setAllContentDirty();
 }
 
 // ==================== Helpers ====================
-uint16_t getPriorityColor(const char* priority) {
-  if (!priority) return COLOR_PRIORITY_NORMAL;
-  if (strcmp(priority, "high") == 0) return COLOR_PRIORITY_HIGH;
-  if (strcmp(priority, "medium") == 0) return COLOR_PRIORITY_MEDIUM;
+uint16_t getPriorityColor(TextSlice priority) {
+  if (textEquals(priority, "high")) return COLOR_PRIORITY_HIGH;
+  if (textEquals(priority, "medium")) return COLOR_PRIORITY_MEDIUM;
   return COLOR_PRIORITY_NORMAL;
 }
 
-String extractSender(String msg) {
-  if (msg.length() == 0) return "Unknown";
-  int colonIndex = msg.lastIndexOf(':');
+TextSlice extractSender(TextSlice msg) {
+  static const TextSlice UNKNOWN = {"Unknown", 7};
+  if (msg.len == 0) return UNKNOWN;
+  int colonIndex = textFindLast(msg, ':');
   if (colonIndex != -1) {
-    String sender = msg.substring(colonIndex + 1);
-    sender.trim();
-    return sender.length() > 0 ? sender : "Unknown";
+    TextSlice sender = textTrim(textSub(msg, colonIndex + 1));
+    return sender.len > 0 ? sender : UNKNOWN;
+  }
+  return msg;
+}
+
+// ==================== Reporting ====================
+String notifStatsJson() {
+  String out = "{\"received\":" + String(received);
+  out += ",\"displayed\":" + String(displayed);
+  out += ",\"merged\":" + String(merged);
+  out += ",\"merged_pct\":" + String(received > 0 ? merged * 100.0f / received : 0.0f, 1);
+  out += ",\"repaints\":" + String(repaints);
+  out += ",\"coalesce_window_ms\":" + String(NOTIF_COALESCE_WINDOW_MS);
+  out += ",\"debounce_ms\":" + String(NOTIF_RENDER_DEBOUNCE_MS);
+  out += ",\"max_hold_ms\":" + String(NOTIF_RENDER_MAX_HOLD_MS);
+  out += ",\"counts\":[";
+  // Live entries, newest first
+  for (int age = 0; age < MAX_NOTIFICATIONS; age++) {
+    if (age > 0) out += ",";
+    out += String(notificationAt(age).count);
   }
-  return msg.length() > 0 ? msg : "Unknown";
+  out += "]}";
+  return out;
 }
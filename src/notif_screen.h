@@ -3,11 +3,32 @@
 
 #include <Arduino.h>
 #include "types.h"
+#include "arena.h"
 
 void drawNotifContent();
-void addNotification(String app, String from, String msg, uint16_t color);
+// Newest first: notificationAt(0) is the latest; empty entries have id 0
+const Notification& notificationAt(int age);
+// Adds an entry, or merges into an on-screen one from the same app and sender
+// within NOTIF_COALESCE_WINDOW_MS
+void addNotification(const char* app, const char* from, const char* msg, uint16_t color);
 void clearAllNotifications();
-uint16_t getPriorityColor(const char* priority);
-String extractSender(String msg);
+void refreshNotificationIcons(uint32_t key);  // Use the icon just stored under key (POST /icon)
+// History paging (render task). step > 0 pages back to older entries; past the
+// oldest page, wrap returns to the latest and otherwise it stays put
+void pageNotifHistory(int step, bool wrap);
+void showLatestNotifs();
+bool browsingNotifHistory();
+void notifHistoryTick();  // Return to the latest after NOTIF_HISTORY_PAGE_TIMEOUT_MS
+int notifTitle(char* buf, size_t size);  // "NOTIFS", or the history page
+
+// How long title/content repaints should still wait for a notification burst
+// to settle, 0 if none (frame scheduler)
+uint32_t notifRepaintHoldMs();
+
+// Received, displayed and merged notifications, repaints and live counts, served by GET /notifstats
+String notifStatsJson();
+
+uint16_t getPriorityColor(TextSlice priority);
+TextSlice extractSender(TextSlice msg);  // A view into msg: the part after the last ':'
 
 #endif
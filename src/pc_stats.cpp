@@ -0,0 +1,99 @@
+#include "pc_stats.h"
+#include <atomic>
+#include "config.h"
+
+static const int SAMPLE_WORDS = sizeof(PcStats) / sizeof(uint32_t);
+static_assert(sizeof(PcStats) % sizeof(uint32_t) == 0, "PcStats must be whole words");
+
+// Odd while the writer is storing words
+static std::atomic<uint32_t> sequence(0);
+// Words are atomics so a torn read is a retry, not undefined behaviour
+static std::atomic<uint32_t> words[SAMPLE_WORDS];
+
+static PcStats latest = {};  // Writer's copy, the base for the next partial update
+
+// Counters
+static uint32_t publishes = 0;                // Writer only
+static std::atomic<uint32_t> readRetries(0);  // Readers on either task
+
+// ==================== Writer ====================
+void publishPcStats(const float values[PC_STAT_COUNT]) {
+  const float* v = values;
+  if (!isnan(v[PC_CPU_TEMP])) latest.cpuTemp = (int)v[PC_CPU_TEMP];
+  if (!isnan(v[PC_CPU_USAGE])) latest.cpuUsage = (int)v[PC_CPU_USAGE];
+  if (!isnan(v[PC_CPU_SPEED])) latest.cpuSpeed = v[PC_CPU_SPEED];
+  if (!isnan(v[PC_RAM_USED])) latest.ramUsed = (int)v[PC_RAM_USED];
+  if (!isnan(v[PC_RAM_TOTAL])) latest.ramTotal = (int)v[PC_RAM_TOTAL];
+  if (!isnan(v[PC_GPU_TEMP])) latest.gpuTemp = (int)v[PC_GPU_TEMP];
+  if (!isnan(v[PC_GPU_USAGE])) latest.gpuUsage = (int)v[PC_GPU_USAGE];
+  if (!isnan(v[PC_NET_DOWN])) latest.netDown = v[PC_NET_DOWN];
+  if (!isnan(v[PC_NET_UP])) latest.netUp = v[PC_NET_UP];
+  latest.updated = millis();
+  if (latest.updated == 0) latest.updated = 1;  // 0 means "never"
+
+  uint32_t src[SAMPLE_WORDS];
+  memcpy(src, &latest, sizeof(src));
+
+  uint32_t seq = sequence.load(std::memory_order_relaxed);
+  sequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);  // Odd before any word
+  for (int i = 0; i < SAMPLE_WORDS; i++) {
+    words[i].store(src[i], std::memory_order_relaxed);
+  }
+  sequence.store(seq + 2, std::memory_order_release);  // Words before even
+  publishes++;
+}
+
+// ==================== Readers ====================
+uint32_t readPcStats(PcStats& out) {
+  uint32_t dst[SAMPLE_WORDS];
+  uint32_t before, after;
+  for (;;) {
+    before = sequence.load(std::memory_order_acquire);
+    if ((before & 1) == 0) {
+      for (int i = 0; i < SAMPLE_WORDS; i++) {
+        dst[i] = words[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);  // Words before the re-check
+      after = sequence.load(std::memory_order_relaxed);
+      if (after == before) {
+        break;
+      }
+    }
+    readRetries++;
+  }
+  memcpy(&out, dst, sizeof(out));
+  return before;
+}
+
+uint32_t pcStatsSequence() {
+  return sequence.load(std::memory_order_acquire);
+}
+
+bool pcStatsFresh() {
+  PcStats s;
+  readPcStats(s);
+  return (millis() - s.updated) <= PC_STATS_TIMEOUT;
+}
+
+// ==================== Reporting ====================
+String pcStatsJson() {
+  PcStats s;
+  uint32_t seq = readPcStats(s);
+  String out = "{\"sequence\":" + String(seq);
+  out += ",\"publishes\":" + String(publishes);
+  out += ",\"read_retries\":" + String(readRetries.load());
+  out += ",\"age_ms\":" + String(s.updated != 0 ? (uint32_t)(millis() - s.updated) : 0);
+  out += ",\"fresh\":" + String(pcStatsFresh() ? "true" : "false");
+  out += ",\"cpu_temp\":" + String(s.cpuTemp);
+  out += ",\"cpu_usage\":" + String(s.cpuUsage);
+  out += ",\"cpu_speed\":" + String(s.cpuSpeed, 1);
+  out += ",\"ram_used\":" + String(s.ramUsed);
+  out += ",\"ram_total\":" + String(s.ramTotal);
+  out += ",\"gpu_temp\":" + String(s.gpuTemp);
+  out += ",\"gpu_usage\":" + String(s.gpuUsage);
+  out += ",\"net_down\":" + String(s.netDown, 1);
+  out += ",\"net_up\":" + String(s.netUp, 1);
+  out += "}";
+  return out;
+}
@@ -0,0 +1,56 @@
+#ifndef PC_STATS_H
+#define PC_STATS_H
+
+#include <Arduino.h>
+
+/**
+ * The latest PC stats sample, published by the /pcstats handler (AsyncTCP
+ * task) and read by the status bar (render task).
+ *
+ * A sample is one struct behind a seqlock: the writer bumps the sequence to
+ * odd, stores the words, then bumps it to even; a reader copies the words and
+ * retries if the sequence was odd or moved meanwhile. Readers therefore always
+ * see one whole sample, never CPU fields from one POST and GPU fields from
+ * the one before, and the writer never waits for them. There is one writer:
+ * AsyncTCP runs handlers one at a time.
+ */
+
+// PC stats fields, in /pcstats parameter order; NAN = not sent, keep the old value
+enum PcStat {
+  PC_CPU_TEMP, PC_CPU_USAGE, PC_CPU_SPEED, PC_RAM_USED, PC_RAM_TOTAL,
+  PC_GPU_TEMP, PC_GPU_USAGE, PC_NET_DOWN, PC_NET_UP, PC_STAT_COUNT
+};
+
+// One sample; plain 32-bit fields so it copies as whole words
+struct PcStats {
+  int cpuTemp;         // °C
+  int cpuUsage;        // %
+  float cpuSpeed;      // GHz
+  int ramUsed;         // GB
+  int ramTotal;        // GB
+  int gpuTemp;         // °C
+  int gpuUsage;        // %
+  float netDown;       // Mbps
+  float netUp;         // Mbps
+  uint32_t updated;    // millis() when received, 0 = never
+};
+
+// Merge the sent fields into the last sample and publish it (AsyncTCP task only)
+void publishPcStats(const float values[PC_STAT_COUNT]);
+
+/**
+ * Copy the latest sample (any task).
+ * @return its sequence number, which changes with every publish
+ */
+uint32_t readPcStats(PcStats& out);
+
+// Sequence of the latest sample; odd while one is being published
+uint32_t pcStatsSequence();
+
+// True if a sample arrived within PC_STATS_TIMEOUT
+bool pcStatsFresh();
+
+// Sequence, publishes and reader retries, plus the sample, served by GET /pcstats
+String pcStatsJson();
+
+#endif
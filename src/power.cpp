@@ -0,0 +1,157 @@
+#include "power.h"
+#include <atomic>
+#include "config.h"
+#include "state.h"
+#include "tasks.h"
+#include "pc_stats.h"
+#ifndef NATIVE_BUILD
+#include <WiFi.h>
+#include <esp_pm.h>
+#include <esp_idf_version.h>
+#endif
+
+enum SleepMode : uint8_t {
+  SLEEP_NONE,         // Disabled, or the host build
+  SLEEP_LIGHT,        // Modem sleep + automatic light sleep (CONFIG_PM_ENABLE builds)
+  SLEEP_CPU_CLOCK     // Modem sleep + CPU at STATIC_IDLE_CPU_MHZ
+};
+
+static const char* const SLEEP_MODE_NAMES[] = {"none", "light_sleep", "cpu_clock"};
+
+static SleepMode sleepMode = SLEEP_NONE;
+#ifndef NATIVE_BUILD
+static uint32_t fullMhz = 0;  // CPU clock outside static idle
+#endif
+static std::atomic<bool> staticIdle(false);  // Read by the input task
+static unsigned long lastActivity = 0;
+static unsigned long lastTick = 0;
+
+// Residency (written by the render task only, read by powerJson())
+static std::atomic<uint32_t> activeMs(0);
+static std::atomic<uint32_t> staticMs(0);
+static std::atomic<uint32_t> entries(0);
+
+// powerJson()'s window baselines, touched only by the AsyncTCP task
+static uint32_t reportedBusyUs[2] = {0, 0};
+static unsigned long lastReportMs = 0;
+
+// ==================== Sleep Control ====================
+#ifndef NATIVE_BUILD
+static esp_err_t configurePm(int minMhz, bool lightSleep) {
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_pm_config_t pm = {};
+#else
+  esp_pm_config_esp32_t pm = {};
+#endif
+  pm.max_freq_mhz = fullMhz;
+  pm.min_freq_mhz = minMhz;
+  pm.light_sleep_enable = lightSleep;
+  return esp_pm_configure(&pm);
+}
+#endif
+
+static void applySleep(bool sleep) {
+#ifndef NATIVE_BUILD
+  if (sleepMode == SLEEP_NONE) {
+    return;
+  }
+  // initWiFi() keeps modem sleep off for request latency
+  WiFi.setSleep(sleep);
+  if (sleepMode == SLEEP_LIGHT) {
+    configurePm(sleep ? STATIC_IDLE_CPU_MHZ : fullMhz, sleep);
+  } else {
+    setCpuFrequencyMhz(sleep ? STATIC_IDLE_CPU_MHZ : fullMhz);
+  }
+#else
+  (void)sleep;
+#endif
+}
+
+static void leaveStaticIdle() {
+  staticIdle = false;
+  applySleep(false);
+}
+
+// ==================== Public API ====================
+void initPower() {
+#if STATIC_IDLE_LIGHT_SLEEP && !defined(NATIVE_BUILD)
+  fullMhz = getCpuFrequencyMhz();
+  // Without CONFIG_PM_ENABLE this reports ESP_ERR_NOT_SUPPORTED
+  esp_err_t err = configurePm(fullMhz, false);
+  sleepMode = err == ESP_OK ? SLEEP_LIGHT : SLEEP_CPU_CLOCK;
+#endif
+  lastActivity = millis();
+  lastTick = millis();
+  lastReportMs = millis();
+  Serial.printf("Power: static idle after %d ms, sleep mode %s\n",
+                STATIC_IDLE_AFTER_MS, SLEEP_MODE_NAMES[sleepMode]);
+}
+
+void powerTick() {
+  unsigned long now = millis();
+  uint32_t elapsed = now - lastTick;
+  lastTick = now;
+  std::atomic<uint32_t>& residency = staticIdle ? staticMs : activeMs;
+  residency.store(residency.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+
+  // The idle disc is what drawNowPlaying() shows with no music and stale stats
+  bool idleScreen = !nowPlayingActive && !pcStatsFresh();
+  bool wantStatic = STATIC_IDLE_AFTER_MS > 0 && idleScreen &&
+                    now - lastActivity >= STATIC_IDLE_AFTER_MS;
+  if (wantStatic && !staticIdle) {
+    staticIdle = true;
+    entries.store(entries.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    applySleep(true);
+  } else if (!wantStatic && staticIdle) {
+    leaveStaticIdle();
+  }
+}
+
+void noteActivity() {
+  lastActivity = millis();
+  if (staticIdle) {
+    leaveStaticIdle();
+  }
+}
+
+bool staticIdleActive() {
+  return staticIdle;
+}
+
+// ==================== Reporting ====================
+String powerJson() {
+  // Core idle is over the window since the previous call
+  unsigned long now = millis();
+  uint32_t windowMs = max(1UL, now - lastReportMs);
+  lastReportMs = now;
+
+  uint32_t active = activeMs.load(std::memory_order_relaxed);
+  uint32_t still = staticMs.load(std::memory_order_relaxed);
+  uint32_t totalMs = active + still;
+  float staticPct = totalMs > 0 ? still * 100.0f / totalMs : 0.0f;
+
+  String out = "{\"static_idle\":" + String(staticIdle ? "true" : "false");
+  out += ",\"static_idle_after_ms\":" + String(STATIC_IDLE_AFTER_MS);
+  out += ",\"sleep_mode\":\"" + String(SLEEP_MODE_NAMES[sleepMode]) + "\"";
+#ifndef NATIVE_BUILD
+  out += ",\"cpu_mhz\":" + String(getCpuFrequencyMhz());
+#endif
+  out += ",\"static_entries\":" + String(entries.load(std::memory_order_relaxed));
+  out += ",\"active_ms\":" + String(active);
+  out += ",\"static_ms\":" + String(still);
+  out += ",\"static_pct\":" + String(staticPct, 1);
+  out += ",\"window_ms\":" + String(windowMs);
+  out += ",\"cores\":[";
+  for (int core = 0; core < 2; core++) {
+    uint32_t busy = taskBusyUsOnCore(core);
+    float busyPct = (uint32_t)(busy - reportedBusyUs[core]) / (windowMs * 10.0f);
+    reportedBusyUs[core] = busy;
+
+    if (core > 0) out += ",";
+    out += "{\"core\":" + String(core);
+    out += ",\"idle_pct\":" + String(max(0.0f, 100.0f - busyPct), 1);
+    out += "}";
+  }
+  out += "]}";
+  return out;
+}
@@ -0,0 +1,34 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <Arduino.h>
+
+/**
+ * Static idle: once the screen has shown the idle disc (no music, stale PC
+ * stats) with no input or API command for STATIC_IDLE_AFTER_MS, the disc
+ * stops, so the render task only wakes for the clock. With nothing animating
+ * the radio may doze (WiFi modem sleep) and, when the PM build supports it,
+ * the CPU light-sleeps between ticks; otherwise it drops to
+ * STATIC_IDLE_CPU_MHZ. Any activity ends static idle at once.
+ *
+ * Power draw cannot be measured from software, so /power reports how long
+ * was spent in each state, and each core's idle share: the time not spent in
+ * this firmware's own tasks (tasks.h), which leaves out WiFi and AsyncTCP.
+ */
+
+// Set up the sleep mode static idle will use (after initWiFi)
+void initPower();
+
+// Update static idle and the residency counters (render task, every wake)
+void powerTick();
+
+// An input or API command arrived (render task)
+void noteActivity();
+
+// True while the disc is stopped; safe to read from any task
+bool staticIdleActive();
+
+// Static idle state, residency and per-core idle, served by /power
+String powerJson();
+
+#endif
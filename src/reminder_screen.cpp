@@ -4,15 +4,27 @@
 #include "screen.h"
 #include "led_control.h"
 #include "storage.h"
+#include "render_metrics.h"
+#include "text_layout.h"
+#include "content_canvas.h"
+#include "reminder_snapshot.h"
 #include <time.h>
 #include "fonts/MDIOTrial_Regular8pt7b.h"
 #include "fonts/MDIOTrial_Bold8pt7b.h"
 
-// ==================== Draw Content ====================
-void drawReminderContent() {
-  // Build sorted list of active reminders
-  int listIdx[MAX_REMINDERS];
-  time_t listTime[MAX_REMINDERS];
+// Layout of the "[id] due in ..." line (Bold, starts at X=27)
+static const int DUE_LINE_X = 27;
+
+// Due line last drawn in each slot, so countdown ticks can damage just that text
+static char drawnDueLine[3][48];
+static int drawnDueWidth[3];
+
+// ==================== List Helpers ====================
+/**
+ * Collect active reminders sorted for display: triggered first, then by time.
+ * @return number of entries written to listIdx/listTime
+ */
+static int buildReminderList(int* listIdx, time_t* listTime) {
   bool listTriggered[MAX_REMINDERS];
   int count = 0;
 
@@ -44,64 +56,108 @@ void drawReminderContent() {
     }
   }
 
+  return count;
+}
+
+// Format "[id] due in 1D 2H 3M" / "[id] due now"
+static void formatDueLine(const Reminder& rm, time_t effTime, time_t now, char* out, size_t outLen) {
+  char buf[32];
+
+  if (rm.triggered) {
+    strcpy(buf, "due now");
+  } else {
+    long diff = effTime - now;
+    long days = diff / 86400;
+    long hours = (diff % 86400) / 3600;
+    long mins = (diff % 3600) / 60;
+
+    strcpy(buf, "due in ");
+    if (days > 0) sprintf(buf + strlen(buf), "%ldD ", days);
+    if (hours > 0) sprintf(buf + strlen(buf), "%ldH ", hours);
+    if (mins > 0 || (days == 0 && hours == 0)) sprintf(buf + strlen(buf), "%ldM", mins);
+  }
+
+  snprintf(out, outLen, "[%d] %s", rm.id, buf);
+}
+
+// ==================== Draw Content ====================
+void drawReminderContent() {
+  TFT_eSPI& canvas = contentCanvas();
+  int originY = contentOriginY();
+
+  // Build sorted list of active reminders
+  int listIdx[MAX_REMINDERS];
+  time_t listTime[MAX_REMINDERS];
+  int count = buildReminderList(listIdx, listTime);
+
   // Display up to 3 reminders (matching 65px slots)
   const int slotYStarts[] = {ZONE_CONTENT1_Y_START, ZONE_CONTENT2_Y_START, ZONE_CONTENT3_Y_START};
   int shown = 0;
   time_t now = time(nullptr);
 
   for (int s = 0; s < count && shown < 3; s++) {
-    int y = slotYStarts[shown] + 5; // Match notif_screen padding
+    int y = slotYStarts[shown] + 5 - originY; // Match notif_screen padding
     Reminder& rm = reminders[listIdx[s]];
 
     // Icon (Centered at X=11 to match 14x14 icon alignment)
     uint16_t iconColor = rm.triggered ? COLOR_REMINDER_ICON_ACTIVE : COLOR_REMINDER_ICON_INACTIVE;
-    tft.fillCircle(11, y + 7, REMINDER_ICON_RADIUS, iconColor);
-    tft.drawCircle(11, y + 7, REMINDER_ICON_RADIUS, COLOR_ICON_BORDER);
-
-    // Line 1: [id] + due time (Bold, starts at X=27)
-    tft.setFreeFont(&MDIOTrial_Bold8pt7b);
-    tft.setTextColor(COLOR_REMINDER_DUE);
-    time_t effTime = listTime[s];
-    char buf[32];
+    canvas.fillCircle(11, y + 7, REMINDER_ICON_RADIUS, contentInk(iconColor));
+    canvas.drawCircle(11, y + 7, REMINDER_ICON_RADIUS, contentInk(COLOR_ICON_BORDER));
+    contentRecordPush(11 - REMINDER_ICON_RADIUS, y + 7 - REMINDER_ICON_RADIUS,
+                      REMINDER_ICON_RADIUS * 2 + 1, REMINDER_ICON_RADIUS * 2 + 1);
+
+    // Line 1: [id] + due time
+    canvas.setFreeFont(&MDIOTrial_Bold8pt7b);
+    canvas.setTextColor(contentInk(COLOR_REMINDER_DUE));
+    formatDueLine(rm, listTime[s], now, drawnDueLine[shown], sizeof(drawnDueLine[shown]));
+    int dueW = canvas.drawString(drawnDueLine[shown], DUE_LINE_X, y);
+    drawnDueWidth[shown] = dueW;
+    contentRecordPush(DUE_LINE_X, y, dueW, canvas.fontHeight());
 
-    if (rm.triggered) {
-      strcpy(buf, "due now");
-    } else {
-      long diff = effTime - now;
-      long days = diff / 86400;
-      long hours = (diff % 86400) / 3600;
-      long mins = (diff % 3600) / 60;
-
-      strcpy(buf, "due in ");
-      if (days > 0) sprintf(buf + strlen(buf), "%ldD ", days);
-      if (hours > 0) sprintf(buf + strlen(buf), "%ldH ", hours);
-      if (mins > 0 || (days == 0 && hours == 0)) sprintf(buf + strlen(buf), "%ldM", mins);
+    // Message (Starting from X=5 for more space, match notif_screen logic)
+    canvas.setFreeFont(&MDIOTrial_Regular8pt7b);
+    canvas.setTextColor(contentInk(rm.triggered ? COLOR_REMINDER_ACTIVE : COLOR_REMINDER_INACTIVE));
+    TextLine lines[CONTENT_TEXT_LINES];
+    int lineCount = layoutWrap(FONT_REGULAR_8, rm.message.c_str(), CONTENT_TEXT_MAX_W,
+                               lines, CONTENT_TEXT_LINES);
+    for (int l = 0; l < lineCount; l++) {
+      int lineY = y + 20 * (l + 1);
+      int lineW = drawTextLine(canvas, rm.message.c_str(), lines[l], 5, lineY);
+      contentRecordPush(5, lineY, lineW, canvas.fontHeight());
     }
 
-    String line1 = "[" + String(rm.id) + "] " + String(buf);
-    tft.drawString(line1, 27, y);
+    shown++;
+  }
+}
 
-    // Message (Starting from X=5 for more space, match notif_screen logic)
-    tft.setFreeFont(&MDIOTrial_Regular8pt7b);
-    tft.setTextColor(rm.triggered ? COLOR_REMINDER_ACTIVE : COLOR_REMINDER_INACTIVE);
-    String msg = rm.message;
-    if (msg.length() > REMINDER_MSG_MAX_CHARS - 1) {
-      msg = msg.substring(0, REMINDER_MSG_MAX_CHARS - 1) + "...";
-    }
+// ==================== Countdown Refresh ====================
+void refreshReminderCountdowns() {
+  int listIdx[MAX_REMINDERS];
+  time_t listTime[MAX_REMINDERS];
+  int count = buildReminderList(listIdx, listTime);
 
-    // Line 1
-    String msgLine1 = msg.substring(0, min(NOTIF_MSG_LINE_CHARS, (int)msg.length()));
-    msgLine1.trim();
-    tft.drawString(msgLine1, 5, y + 20);
+  const Zone slotZones[] = {ZONE_CONTENT1, ZONE_CONTENT2, ZONE_CONTENT3};
+  const int slotYStarts[] = {ZONE_CONTENT1_Y_START, ZONE_CONTENT2_Y_START, ZONE_CONTENT3_Y_START};
+  time_t now = time(nullptr);
 
-    // Line 2
-    if (msg.length() > NOTIF_MSG_LINE_CHARS) {
-      String msgLine2 = msg.substring(NOTIF_MSG_LINE_CHARS);
-      msgLine2.trim();
-      tft.drawString(msgLine2, 5, y + 40);
+  tft.setFreeFont(&MDIOTrial_Bold8pt7b);
+  for (int s = 0; s < count && s < 3; s++) {
+    char line[sizeof(drawnDueLine[s])];
+    formatDueLine(reminders[listIdx[s]], listTime[s], now, line, sizeof(line));
+    if (strcmp(line, drawnDueLine[s]) == 0) continue;
+
+    // Skip the unchanged prefix ("[1] due in 2H "), then cover both the old
+    // and the new text so a shorter string erases the tail
+    char prefix[sizeof(line)];
+    int n = 0;
+    while (line[n] != '\0' && line[n] == drawnDueLine[s][n]) {
+      prefix[n] = line[n];
+      n++;
     }
-
-    shown++;
+    prefix[n] = '\0';
+    int skipW = n > 0 ? tft.textWidth(prefix) : 0;
+    int w = max(drawnDueWidth[s], (int)tft.textWidth(line)) - skipW;
+    addZoneDamage(slotZones[s], DUE_LINE_X + skipW, slotYStarts[s] + 5, w, tft.fontHeight());
   }
 }
 
@@ -142,7 +198,7 @@ void checkReminders() {
 }
 
 // ==================== Add Reminder ====================
-int addReminder(String msg, time_t when, int limitMins, uint16_t color) {
+int addReminder(int id, String msg, time_t when, int limitMins, uint16_t color) {
   // Find free slot
   int idx = -1;
   for (int i = 0; i < MAX_REMINDERS; i++) {
@@ -154,7 +210,7 @@ int addReminder(String msg, time_t when, int limitMins, uint16_t color) {
 
   if (idx == -1) return -1;  // No free slot
 
-  reminders[idx].id = nextReminderId++;
+  reminders[idx].id = id;
   reminders[idx].message = msg;
   reminders[idx].when = when;
   reminders[idx].limitMinutes = max(0, limitMins);
@@ -166,6 +222,7 @@ int addReminder(String msg, time_t when, int limitMins, uint16_t color) {
 
   setAllContentDirty();
   saveReminders();  // Persist to flash
+  publishReminders();
 
   return reminders[idx].id;
 }
@@ -179,32 +236,47 @@ bool completeReminder(int id) {
       ledOff();
       setAllContentDirty();
       saveReminders();  // Persist to flash
+      publishReminders();
+      releaseReminderSlot();
       return true;
     }
   }
   return false;
 }
 
-// ==================== List Reminders JSON ====================
+// ==================== API Views ====================
+// Published list as the AsyncTCP task last read it; too big for its stack
+static ReminderSnapshot apiView;
+
+bool hasReminder(int id) {
+  readReminders(apiView);
+  for (int i = 0; i < MAX_REMINDERS; i++) {
+    if (id != 0 && apiView.items[i].id == id) return true;
+  }
+  return false;
+}
+
 String listRemindersJson() {
+  readReminders(apiView);
   String out = "[";
   bool first = true;
 
   for (int i = 0; i < MAX_REMINDERS; i++) {
-    Reminder& r = reminders[i];
+    const ReminderInfo& r = apiView.items[i];
     if (r.id == 0) continue;
 
     if (!first) out += ",";
     first = false;
 
+    time_t when = (time_t)r.when;
     struct tm tm;
-    localtime_r(&r.when, &tm);
+    localtime_r(&when, &tm);
     char buf[32];
     strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M", &tm);
 
     out += "{";
     out += "\"id\":" + String(r.id) + ",";
-    out += "\"message\":\"" + r.message + "\",";
+    out += "\"message\":\"" + String(r.message) + "\",";
     out += "\"time\":\"" + String(buf) + "\",";
     out += "\"limit\":" + String(r.limitMinutes) + ",";
     out += "\"completed\":" + String(r.completed ? "true" : "false") + ",";
@@ -218,14 +290,21 @@ String listRemindersJson() {
 }
 
 // ==================== Parse DateTime ====================
-time_t parseDateTime(const String& dt) {
-  if (dt.length() < 16) return 0;
-
-  int year = dt.substring(0, 4).toInt();
-  int month = dt.substring(5, 7).toInt();
-  int day = dt.substring(8, 10).toInt();
-  int hour = dt.substring(11, 13).toInt();
-  int minute = dt.substring(14, 16).toInt();
+// Number in dt[start, end), as String::toInt() would read that substring
+static int fieldInt(TextSlice dt, int start, int end) {
+  char buf[8];
+  textCopy(buf, sizeof(buf), textSub(dt, start, end));
+  return atoi(buf);
+}
+
+time_t parseDateTime(TextSlice dt) {
+  if (dt.len < 16) return 0;
+
+  int year = fieldInt(dt, 0, 4);
+  int month = fieldInt(dt, 5, 7);
+  int day = fieldInt(dt, 8, 10);
+  int hour = fieldInt(dt, 11, 13);
+  int minute = fieldInt(dt, 14, 16);
 
   if (year < 2000 || month < 1 || month > 12 || day < 1) return 0;
 
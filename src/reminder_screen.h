@@ -3,12 +3,18 @@
 
 #include <Arduino.h>
 #include "types.h"
+#include "arena.h"
 
 void drawReminderContent();
+void refreshReminderCountdowns();  // Damage only the due lines whose text changed
 void checkReminders();
-int addReminder(String msg, time_t when, int limitMins, uint16_t color);
+int addReminder(int id, String msg, time_t when, int limitMins, uint16_t color);  // -1 if full
 bool completeReminder(int id);
+
+// Views of the published list for API handlers (AsyncTCP task only;
+// reminder_snapshot.h), which queue any change themselves (command_queue.h)
 String listRemindersJson();
-time_t parseDateTime(const String& dt);
+bool hasReminder(int id);
+time_t parseDateTime(TextSlice dt);
 
 #endif
@@ -0,0 +1,99 @@
+#include "reminder_snapshot.h"
+#include <atomic>
+#include "state.h"
+
+static const int ITEM_WORDS = sizeof(ReminderInfo) / sizeof(uint32_t);
+static_assert(sizeof(ReminderInfo) % sizeof(uint32_t) == 0, "ReminderInfo must be whole words");
+
+// Odd while the writer is storing words
+static std::atomic<uint32_t> sequence(0);
+// Words are atomics so a torn read is a retry, not undefined behaviour
+static std::atomic<uint32_t> words[MAX_REMINDERS * ITEM_WORDS];
+
+// Slots neither holding a reminder nor claimed by a queued add
+static std::atomic<int> freeSlots(MAX_REMINDERS);
+
+// ==================== Writer ====================
+void initReminderSnapshot() {
+  int used = 0;
+  for (int i = 0; i < MAX_REMINDERS; i++) {
+    if (reminders[i].id != 0) used++;
+  }
+  freeSlots.store(MAX_REMINDERS - used);
+  publishReminders();
+}
+
+void publishReminders() {
+  uint32_t seq = sequence.load(std::memory_order_relaxed);
+  sequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);  // Odd before any word
+
+  // One item at a time keeps the staging copy on the stack small
+  for (int i = 0; i < MAX_REMINDERS; i++) {
+    const Reminder& r = reminders[i];
+    ReminderInfo item = {};
+    item.id = r.id;
+    if (r.id != 0) {
+      item.when = (uint32_t)r.when;
+      item.limitMinutes = r.limitMinutes;
+      item.color = r.color;
+      item.completed = r.completed ? 1 : 0;
+      snprintf(item.message, sizeof(item.message), "%s", r.message.c_str());
+    }
+
+    uint32_t src[ITEM_WORDS];
+    memcpy(src, &item, sizeof(src));
+    std::atomic<uint32_t>* dst = &words[i * ITEM_WORDS];
+    for (int w = 0; w < ITEM_WORDS; w++) {
+      dst[w].store(src[w], std::memory_order_relaxed);
+    }
+  }
+  sequence.store(seq + 2, std::memory_order_release);  // Words before even
+}
+
+// ==================== Readers ====================
+uint32_t readReminders(ReminderSnapshot& out) {
+  uint32_t before, after;
+  for (;;) {
+    before = sequence.load(std::memory_order_acquire);
+    if ((before & 1) == 0) {
+      for (int i = 0; i < MAX_REMINDERS; i++) {
+        uint32_t src[ITEM_WORDS];
+        const std::atomic<uint32_t>* from = &words[i * ITEM_WORDS];
+        for (int w = 0; w < ITEM_WORDS; w++) {
+          src[w] = from[w].load(std::memory_order_relaxed);
+        }
+        memcpy(&out.items[i], src, sizeof(src));
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);  // Words before the re-check
+      after = sequence.load(std::memory_order_relaxed);
+      if (after == before) {
+        break;
+      }
+    }
+  }
+  return before;
+}
+
+// ==================== Reservations ====================
+bool reserveReminderSlot() {
+  int free = freeSlots.load();
+  while (free > 0) {
+    if (freeSlots.compare_exchange_weak(free, free - 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void releaseReminderSlot() {
+  freeSlots.fetch_add(1);
+}
+
+int reserveReminderId() {
+  return nextReminderId.fetch_add(1);
+}
+
+int reminderSlotsFree() {
+  return freeSlots.load();
+}
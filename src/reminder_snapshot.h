@@ -0,0 +1,59 @@
+#ifndef REMINDER_SNAPSHOT_H
+#define REMINDER_SNAPSHOT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * The reminder list as API handlers see it.
+ *
+ * reminders[] belongs to the render task: it adds, completes and triggers
+ * them. After every change it publishes a plain copy here behind a seqlock,
+ * the same way pc_stats.h publishes samples, and GET /reminders and the
+ * /completeReminder id check read that copy instead of the live table, so
+ * the AsyncTCP task never touches a String the render task may be freeing.
+ *
+ * Slots and ids for new reminders are claimed atomically when the add is
+ * queued, so once a handler has answered "added" the render task always has
+ * room for it.
+ */
+
+// One reminder; plain fields so it copies as whole words
+struct ReminderInfo {
+  int32_t id;                          // 0 = free slot
+  uint32_t when;                       // Epoch seconds
+  int32_t limitMinutes;
+  uint16_t color;
+  uint8_t completed;
+  uint8_t reserved;
+  char message[COMMAND_TEXT_CHARS];    // Truncated copy, terminated
+};
+
+struct ReminderSnapshot {
+  ReminderInfo items[MAX_REMINDERS];   // In reminders[] slot order
+};
+
+// Count the loaded reminders' slots as taken and publish them (setup, after initStorage)
+void initReminderSnapshot();
+
+// Publish reminders[] (render task only, after any change to it)
+void publishReminders();
+
+/**
+ * Copy the latest published list (any task). It is several KB: give it a
+ * static, not the stack.
+ * @return its sequence number, which changes with every publish
+ */
+uint32_t readReminders(ReminderSnapshot& out);
+
+// Claim a free slot for a reminder about to be queued; false if all are taken
+bool reserveReminderSlot();
+// Give a slot back: the add was not queued, or a reminder was completed
+void releaseReminderSlot();
+// Unique id for a new reminder (any task)
+int reserveReminderId();
+
+// Free slots not yet claimed by a queued add
+int reminderSlotsFree();
+
+#endif
@@ -0,0 +1,356 @@
+#include "render_metrics.h"
+#include <atomic>
+#include "config.h"
+#include "state.h"
+
+#if RENDER_METRICS_ENABLED
+
+static const char* ZONE_NAMES[ZONE_COUNT] = {
+  "title", "clock", "status", "content1", "content2", "content3"
+};
+
+static const char* FN_NAMES[RENDER_FN_COUNT] = {
+  "clearZone", "drawTitle", "updateClock", "drawNowPlaying",
+  "drawPcStats", "drawNotifContent", "drawReminderContent", "drawCalendarContent"
+};
+
+// Lifetime totals (64-bit: the status ticker alone pushes ~128k px/s)
+struct RenderTotals {
+  uint64_t draws;
+  uint64_t pixels;
+  uint64_t bytes;
+  uint64_t micros;
+};
+
+// Two windows: [curWindow] is filling, the other is the last complete one
+static RenderStats zoneStats[2][ZONE_COUNT];
+static RenderStats fnStats[2][RENDER_FN_COUNT];
+static RenderTotals zoneTotals[ZONE_COUNT];
+static RenderTotals fnTotals[RENDER_FN_COUNT];
+static int curWindow = 0;
+static unsigned long windowStart = 0;
+static bool haveLastWindow = false;
+
+// The last complete window as /metrics serves it. Only the render task rolls
+// windows; it copies each finished one here behind a seqlock (as pc_stats.cpp
+// does) so the AsyncTCP task never reads counters that are being cleared.
+struct MetricsReport {
+  RenderStats zones[ZONE_COUNT];
+  RenderStats fns[RENDER_FN_COUNT];
+  RenderTotals zoneTotals[ZONE_COUNT];
+  RenderTotals fnTotals[RENDER_FN_COUNT];
+  uint32_t windows;  // Windows completed so far
+  uint32_t reserved;
+};
+static const int REPORT_WORDS = sizeof(MetricsReport) / sizeof(uint32_t);
+static_assert(sizeof(MetricsReport) % sizeof(uint32_t) == 0, "MetricsReport must be whole words");
+
+// Odd while the render task is storing words
+static std::atomic<uint32_t> reportSequence(0);
+static std::atomic<uint32_t> reportWords[REPORT_WORDS];
+static uint32_t windowsCompleted = 0;
+
+// Open scopes
+struct Scope {
+  Zone zone;
+  RenderFn fn;
+  unsigned long start;
+};
+static const int MAX_SCOPE_DEPTH = 4;
+static Scope scopes[MAX_SCOPE_DEPTH];
+static int scopeDepth = 0;
+static uint32_t outerZonePixels[ZONE_COUNT];  // Pixels per zone in the outermost scope
+
+// Active clip rect (set while a damage rect is repainted)
+static bool clipActive = false;
+static int clipX, clipY, clipW, clipH;
+
+// ==================== Helpers ====================
+static int histBucket(uint32_t us) {
+  int bucket = 0;
+  uint32_t limit = 128;
+  while (bucket < RENDER_HIST_BUCKETS - 1 && us >= limit) {
+    limit <<= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+static void recordTime(RenderStats& s, uint32_t us) {
+  s.draws++;
+  s.micros += us;
+  if (us > s.maxMicros) s.maxMicros = us;
+  s.hist[histBucket(us)]++;
+}
+
+static void storeReportWords(const uint32_t* src, int first, int count) {
+  for (int i = 0; i < count; i++) {
+    reportWords[first + i].store(src[i], std::memory_order_relaxed);
+  }
+}
+
+// Copy the window that just closed into the report (render task only)
+static void publishReport(int win) {
+  uint32_t seq = reportSequence.load(std::memory_order_relaxed);
+  reportSequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);  // Odd before any word
+
+  // Straight from the live arrays, so no staging copy on the render stack
+  storeReportWords((const uint32_t*)zoneStats[win], offsetof(MetricsReport, zones) / 4,
+                   sizeof(zoneStats[win]) / 4);
+  storeReportWords((const uint32_t*)fnStats[win], offsetof(MetricsReport, fns) / 4,
+                   sizeof(fnStats[win]) / 4);
+  storeReportWords((const uint32_t*)zoneTotals, offsetof(MetricsReport, zoneTotals) / 4,
+                   sizeof(zoneTotals) / 4);
+  storeReportWords((const uint32_t*)fnTotals, offsetof(MetricsReport, fnTotals) / 4,
+                   sizeof(fnTotals) / 4);
+  uint32_t tail[2] = {windowsCompleted, 0};
+  storeReportWords(tail, offsetof(MetricsReport, windows) / 4, 2);
+
+  reportSequence.store(seq + 2, std::memory_order_release);  // Words before even
+}
+
+// Copy the latest published report (any task)
+static void readReport(MetricsReport& out) {
+  uint32_t* dst = (uint32_t*)&out;
+  for (;;) {
+    uint32_t before = reportSequence.load(std::memory_order_acquire);
+    if (before & 1) continue;
+    for (int i = 0; i < REPORT_WORDS; i++) {
+      dst[i] = reportWords[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);  // Words before the re-check
+    if (reportSequence.load(std::memory_order_relaxed) == before) {
+      return;
+    }
+  }
+}
+
+static bool rollWindow(unsigned long now) {
+  if (now - windowStart < RENDER_METRICS_WINDOW_MS) {
+    return false;
+  }
+  windowsCompleted++;
+  publishReport(curWindow);
+  curWindow ^= 1;
+  memset(zoneStats[curWindow], 0, sizeof(zoneStats[curWindow]));
+  memset(fnStats[curWindow], 0, sizeof(fnStats[curWindow]));
+  windowStart = now;
+  haveLastWindow = true;
+  return true;
+}
+
+static String u64String(uint64_t v) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%llu", (unsigned long long)v);
+  return String(buf);
+}
+
+// ==================== Scopes ====================
+void metricsBegin(Zone zone, RenderFn fn) {
+  if (scopeDepth >= MAX_SCOPE_DEPTH) {
+    return;
+  }
+  if (scopeDepth == 0) {
+    memset(outerZonePixels, 0, sizeof(outerZonePixels));
+  }
+  scopes[scopeDepth].zone = zone;
+  scopes[scopeDepth].fn = fn;
+  scopes[scopeDepth].start = micros();
+  scopeDepth++;
+}
+
+void metricsEnd() {
+  if (scopeDepth == 0) {
+    return;
+  }
+  scopeDepth--;
+  const Scope& sc = scopes[scopeDepth];
+  uint32_t us = micros() - sc.start;
+
+  recordTime(fnStats[curWindow][sc.fn], us);
+  fnTotals[sc.fn].draws++;
+  fnTotals[sc.fn].micros += us;
+
+  if (scopeDepth > 0) {
+    return;
+  }
+
+  // Outermost scope: charge time to zones in proportion to pixels pushed
+  uint32_t totalPixels = 0;
+  for (int z = 0; z < ZONE_COUNT; z++) {
+    totalPixels += outerZonePixels[z];
+  }
+
+  if (totalPixels == 0) {
+    recordTime(zoneStats[curWindow][sc.zone], us);
+    zoneTotals[sc.zone].draws++;
+    zoneTotals[sc.zone].micros += us;
+  } else {
+    for (int z = 0; z < ZONE_COUNT; z++) {
+      if (outerZonePixels[z] == 0) continue;
+      uint32_t share = (uint32_t)((uint64_t)us * outerZonePixels[z] / totalPixels);
+      recordTime(zoneStats[curWindow][z], share);
+      zoneTotals[z].draws++;
+      zoneTotals[z].micros += share;
+    }
+  }
+
+  rollWindow(millis());
+}
+
+// ==================== Pixel Accounting ====================
+void metricsSetClip(int x, int y, int w, int h) {
+  clipActive = true;
+  clipX = x;
+  clipY = y;
+  clipW = w;
+  clipH = h;
+}
+
+void metricsClearClip() {
+  clipActive = false;
+}
+
+void metricsRecordPush(int x, int y, int w, int h) {
+  if (clipActive) {
+    int x0 = max(x, clipX), y0 = max(y, clipY);
+    int x1 = min(x + w, clipX + clipW), y1 = min(y + h, clipY + clipH);
+    x = x0;
+    y = y0;
+    w = x1 - x0;
+    h = y1 - y0;
+  }
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+
+  uint32_t pixels = (uint32_t)w * h;
+  uint32_t bytes = pixels * 2 + SPI_WINDOW_OVERHEAD_BYTES;
+
+  if (scopeDepth > 0) {
+    RenderFn fn = scopes[scopeDepth - 1].fn;
+    RenderStats& f = fnStats[curWindow][fn];
+    f.pushes++;
+    f.pixels += pixels;
+    f.bytes += bytes;
+    fnTotals[fn].pixels += pixels;
+    fnTotals[fn].bytes += bytes;
+  }
+
+  // Split the rect across the zones it overlaps
+  for (int z = 0; z < ZONE_COUNT; z++) {
+    int zx, zy, zw, zh;
+    if (!getZoneBounds((Zone)z, &zx, &zy, &zw, &zh)) continue;
+    int ix0 = max(x, zx), iy0 = max(y, zy);
+    int ix1 = min(x + w, zx + zw), iy1 = min(y + h, zy + zh);
+    if (ix0 >= ix1 || iy0 >= iy1) continue;
+
+    uint32_t zonePixels = (uint32_t)(ix1 - ix0) * (iy1 - iy0);
+    uint32_t zoneBytes = zonePixels * 2 + SPI_WINDOW_OVERHEAD_BYTES;
+    RenderStats& s = zoneStats[curWindow][z];
+    s.pushes++;
+    s.pixels += zonePixels;
+    s.bytes += zoneBytes;
+    zoneTotals[z].pixels += zonePixels;
+    zoneTotals[z].bytes += zoneBytes;
+    if (scopeDepth > 0) {
+      outerZonePixels[z] += zonePixels;
+    }
+  }
+}
+
+void metricsRecordSpriteFill(int w, int h) {
+  if (scopeDepth == 0 || w <= 0 || h <= 0) {
+    return;
+  }
+  const Scope& sc = scopes[scopeDepth - 1];
+  fnStats[curWindow][sc.fn].bgPixels += (uint32_t)w * h;
+  zoneStats[curWindow][sc.zone].bgPixels += (uint32_t)w * h;
+}
+
+// ==================== Reporting ====================
+void metricsTick() {
+  bool rolled = rollWindow(millis());
+#if RENDER_METRICS_SERIAL
+  if (rolled) {
+    metricsPrintSerial();
+  }
+#else
+  (void)rolled;
+#endif
+}
+
+static void printRow(const char* name, const RenderStats& s) {
+  uint32_t avg = s.draws ? s.micros / s.draws : 0;
+  Serial.printf("  %-20s %6u %8u %9u %9u %7u %7u\n", name, s.draws, s.pixels, s.bytes,
+                s.bgPixels, avg, s.maxMicros);
+}
+
+void metricsPrintSerial() {
+  int win = haveLastWindow ? (curWindow ^ 1) : curWindow;
+  Serial.printf("=== Render metrics (%lu ms window) ===\n", (unsigned long)RENDER_METRICS_WINDOW_MS);
+  Serial.println("  name                  draws   pixels  spiBytes  bgPixels  avgUs   maxUs");
+  for (int z = 0; z < ZONE_COUNT; z++) {
+    printRow(ZONE_NAMES[z], zoneStats[win][z]);
+  }
+  for (int f = 0; f < RENDER_FN_COUNT; f++) {
+    printRow(FN_NAMES[f], fnStats[win][f]);
+  }
+}
+
+static void appendStatsJson(String& out, const char* key, const char* name,
+                            const RenderStats& s, const RenderTotals& t) {
+  out += "{\"";
+  out += key;
+  out += "\":\"";
+  out += name;
+  out += "\",\"draws\":" + String(s.draws);
+  out += ",\"pushes\":" + String(s.pushes);
+  out += ",\"pixels\":" + String(s.pixels);
+  out += ",\"spi_bytes\":" + String(s.bytes);
+  out += ",\"bg_pixels\":" + String(s.bgPixels);
+  out += ",\"us\":" + String(s.micros);
+  out += ",\"max_us\":" + String(s.maxMicros);
+  out += ",\"hist_us\":[";
+  for (int b = 0; b < RENDER_HIST_BUCKETS; b++) {
+    if (b > 0) out += ",";
+    out += String(s.hist[b]);
+  }
+  out += "],\"total_draws\":" + u64String(t.draws);
+  out += ",\"total_pixels\":" + u64String(t.pixels);
+  out += ",\"total_spi_bytes\":" + u64String(t.bytes);
+  out += ",\"total_us\":" + u64String(t.micros);
+  out += "}";
+}
+
+String metricsJson() {
+  // Over 1 KB: static rather than on the AsyncTCP stack
+  static MetricsReport report;
+  readReport(report);
+
+  String out = "{\"window_ms\":" + String((unsigned long)RENDER_METRICS_WINDOW_MS);
+  out += ",\"complete\":" + String(report.windows > 0 ? "true" : "false");
+  out += ",\"windows\":" + String(report.windows);
+  out += ",\"hist_bounds_us\":[";
+  uint32_t limit = 128;
+  for (int b = 0; b < RENDER_HIST_BUCKETS - 1; b++) {
+    if (b > 0) out += ",";
+    out += String(limit);
+    limit <<= 1;
+  }
+  out += "],\"zones\":[";
+  for (int z = 0; z < ZONE_COUNT; z++) {
+    if (z > 0) out += ",";
+    appendStatsJson(out, "zone", ZONE_NAMES[z], report.zones[z], report.zoneTotals[z]);
+  }
+  out += "],\"functions\":[";
+  for (int f = 0; f < RENDER_FN_COUNT; f++) {
+    if (f > 0) out += ",";
+    appendStatsJson(out, "fn", FN_NAMES[f], report.fns[f], report.fnTotals[f]);
+  }
+  out += "]}";
+  return out;
+}
+
+#endif
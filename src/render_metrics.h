@@ -0,0 +1,83 @@
+#ifndef RENDER_METRICS_H
+#define RENDER_METRICS_H
+
+#include <Arduino.h>
+#include "types.h"
+
+// ==================== Draw Functions ====================
+enum RenderFn {
+  RENDER_FN_CLEAR_ZONE = 0,
+  RENDER_FN_TITLE,
+  RENDER_FN_CLOCK,
+  RENDER_FN_NOW_PLAYING,
+  RENDER_FN_PC_STATS,
+  RENDER_FN_NOTIFS,
+  RENDER_FN_REMINDERS,
+  RENDER_FN_CALENDAR,
+  RENDER_FN_COUNT
+};
+
+#define RENDER_HIST_BUCKETS 11  // <128us, <256us ... <64ms, >=64ms
+
+/**
+ * Counters for one zone or draw function over a window.
+ * pixels/bytes are what went over SPI; bgPixels are background copies
+ * into RAM sprites (prepareZoneSprite), which cost CPU but no SPI time.
+ */
+struct RenderStats {
+  uint32_t draws;
+  uint32_t pushes;
+  uint32_t pixels;
+  uint32_t bytes;
+  uint32_t bgPixels;
+  uint32_t micros;
+  uint32_t maxMicros;
+  uint16_t hist[RENDER_HIST_BUCKETS];
+};
+
+#if RENDER_METRICS_ENABLED
+
+/**
+ * Open/close a measured draw. Scopes nest (e.g. drawNowPlaying -> drawPcStats):
+ * function time is inclusive, zone time is charged once by the outermost scope,
+ * split across zones by the pixels each one received.
+ */
+void metricsBegin(Zone zone, RenderFn fn);
+void metricsEnd();
+
+// Record a w x h block sent to the panel; zones are derived from the rect.
+// Text drawn straight to the TFT is recorded as its bounding box (upper bound).
+void metricsRecordPush(int x, int y, int w, int h);
+
+// Record background pixels copied into an off-screen sprite
+void metricsRecordSpriteFill(int w, int h);
+
+// Clip recorded pushes to the damage rect being repainted (mirrors tft.setViewport)
+void metricsSetClip(int x, int y, int w, int h);
+void metricsClearClip();
+
+// Serial table for the last complete window (also called by metricsTick when enabled)
+void metricsPrintSerial();
+
+// Rolls the window over and prints to serial if RENDER_METRICS_SERIAL (call in loop)
+void metricsTick();
+
+// JSON report served by /metrics: the last complete window as the render task
+// published it, safe to call from any task (it never rolls the window itself)
+String metricsJson();
+
+#else
+
+inline void metricsBegin(Zone, RenderFn) {}
+inline void metricsEnd() {}
+inline void metricsRecordPush(int, int, int, int) {}
+inline void metricsRecordSpriteFill(int, int) {}
+inline void metricsSetClip(int, int, int, int) {}
+inline void metricsClearClip() {}
+inline void metricsPrintSerial() {}
+inline void metricsTick() {}
+inline String metricsJson() { return "{\"enabled\":false}"; }
+
+#endif
+
+#endif
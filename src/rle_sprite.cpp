@@ -0,0 +1,75 @@
+#include "rle_sprite.h"
+#include "config.h"
+
+static uint16_t lineBlock[TFT_WIDTH * RLE_BLOCK_LINES];
+
+// ==================== Decoder ====================
+static void decodeRow(const RleSprite& sprite, int row, uint16_t* out) {
+  const uint8_t* p = sprite.data + pgm_read_word(&sprite.rows[row]);
+  uint16_t* end = out + sprite.width;
+  while (out < end) {
+    uint8_t run = pgm_read_byte(p++);
+    int len = (run & 0x0F) + 1;
+    if (len == 16) {
+      len += pgm_read_byte(p++);
+    }
+    uint16_t color = pgm_read_word(&sprite.palette[run >> 4]);
+    if (len > end - out) {
+      len = end - out;
+    }
+    while (len--) {
+      *out++ = color;
+    }
+  }
+}
+
+void drawRleSprite(TFT_eSPI& canvas, int x, int y, const RleSprite& sprite) {
+  if (sprite.width > TFT_WIDTH) {
+    return;
+  }
+
+  int vpY = canvas.getViewportY();
+  int first = max(0, vpY - y);
+  int last = min((int)sprite.height, vpY + (int)canvas.getViewportHeight() - y);
+
+  for (int row = first; row < last; row += RLE_BLOCK_LINES) {
+    int lines = min(RLE_BLOCK_LINES, last - row);
+    for (int l = 0; l < lines; l++) {
+      decodeRow(sprite, row + l, lineBlock + l * sprite.width);
+    }
+    canvas.pushImage(x, y + row, sprite.width, lines, lineBlock);
+  }
+}
+
+void drawRleSpriteRuns(TFT_eSPI& canvas, int x, int y, const RleSprite& sprite,
+                       uint16_t (*mapColor)(uint16_t)) {
+  // Palette entries are mapped on first use (the palette size isn't stored);
+  // they are kept in pushImage byte order
+  uint16_t colors[16];
+  uint16_t mapped = 0;
+
+  int vpY = canvas.getViewportY();
+  int first = max(0, vpY - y);
+  int last = min((int)sprite.height, vpY + (int)canvas.getViewportHeight() - y);
+
+  for (int row = first; row < last; row++) {
+    const uint8_t* p = sprite.data + pgm_read_word(&sprite.rows[row]);
+    int col = 0;
+    while (col < sprite.width) {
+      uint8_t run = pgm_read_byte(p++);
+      int len = (run & 0x0F) + 1;
+      if (len == 16) {
+        len += pgm_read_byte(p++);
+      }
+      len = min(len, sprite.width - col);
+      int idx = run >> 4;
+      if (!(mapped & (1 << idx))) {
+        uint16_t c = pgm_read_word(&sprite.palette[idx]);
+        colors[idx] = mapColor((uint16_t)((c >> 8) | (c << 8)));
+        mapped |= 1 << idx;
+      }
+      canvas.drawFastHLine(x + col, y + row, len, colors[idx]);
+      col += len;
+    }
+  }
+}
@@ -0,0 +1,37 @@
+#ifndef RLE_SPRITE_H
+#define RLE_SPRITE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+/**
+ * Palette + run-length image, generated by tools/split_sprite.py.
+ * Each row is a list of run bytes: high nibble = palette index, low nibble =
+ * length - 1 (1..15 px); a low nibble of 15 means 16 + the next byte
+ * (16..271 px). rows[] holds each row's offset into data, so repeated rows
+ * are stored once. Palette entries are in pushImage byte order.
+ */
+struct RleSprite {
+  uint16_t width;
+  uint16_t height;
+  const uint16_t* palette;  // Up to 16 colours
+  const uint16_t* rows;
+  const uint8_t* data;
+};
+
+/**
+ * Decode scanlines into a small line buffer and push them to canvas with the
+ * top-left at (x, y), RLE_BLOCK_LINES rows per pushImage. Rows outside the
+ * canvas viewport are skipped. Width must not exceed TFT_WIDTH.
+ */
+void drawRleSprite(TFT_eSPI& canvas, int x, int y, const RleSprite& sprite);
+
+/**
+ * Draw the runs straight to canvas as horizontal lines, for canvases that take
+ * palette indices instead of pushImage data (4-bit sprites). mapColor turns
+ * each palette entry, as RGB565, into the colour value drawn.
+ */
+void drawRleSpriteRuns(TFT_eSPI& canvas, int x, int y, const RleSprite& sprite,
+                       uint16_t (*mapColor)(uint16_t));
+
+#endif
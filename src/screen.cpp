@@ -4,6 +4,15 @@
 #include "notif_screen.h"
 #include "reminder_screen.h"
 #include "calendar_screen.h"
+#include "render_metrics.h"
+#include "display_dma.h"
+#include "shapes.h"
+#include "rle_sprite.h"
+#include "text_layout.h"
+#include "sprite_pool.h"
+#include "content_canvas.h"
+#include "power.h"
+#include "pc_stats.h"
 #include "icons/icons.h"
 #include "fonts/MDIOTrial_Regular8pt7b.h"
 #include "fonts/MDIOTrial_Regular9pt7b.h"
@@ -28,6 +37,8 @@ void initScreen() {
   tft.setRotation(TFT_ROTATION);
   tft.setFreeFont(&MDIOTrial_Regular8pt7b);
   tft.setTextSize(1);
+  initDisplayDma();
+  initDiscAtlas();
 
 #if DEBUG_SHOW_ZONES
   drawDebugZones();
@@ -37,6 +48,7 @@ void initScreen() {
 // ==================== Debug: Zone Boundaries ====================
 void drawDebugZones() {
   uint16_t debugColor = TFT_WHITE;
+  dmaFence();
 
   // Title zone border
   tft.drawRect(ZONE_TITLE_X_START, ZONE_TITLE_Y_START,
@@ -67,40 +79,16 @@ void drawDebugZones() {
 
 // ==================== Zone Helpers ====================
 void clearZone(Zone zone) {
-  int x_start, y_start, x_end, y_end;
+  int x_start, y_start, zoneW, zoneH;
 
   // Get zone boundaries
-  switch (zone) {
-    case ZONE_TITLE:
-      x_start = ZONE_TITLE_X_START; x_end = ZONE_TITLE_X_END;
-      y_start = ZONE_TITLE_Y_START; y_end = ZONE_TITLE_Y_END;
-      break;
-    case ZONE_CLOCK:
-      x_start = ZONE_CLOCK_X_START; x_end = ZONE_CLOCK_X_END;
-      y_start = ZONE_CLOCK_Y_START; y_end = ZONE_CLOCK_Y_END;
-      break;
-    case ZONE_STATUS:
-      x_start = ZONE_STATUS_X_START; x_end = ZONE_STATUS_X_END;
-      y_start = ZONE_STATUS_Y_START; y_end = ZONE_STATUS_Y_END;
-      break;
-    case ZONE_CONTENT1:
-      x_start = ZONE_CONTENT1_X_START; x_end = ZONE_CONTENT1_X_END;
-      y_start = ZONE_CONTENT1_Y_START; y_end = ZONE_CONTENT1_Y_END;
-      break;
-    case ZONE_CONTENT2:
-      x_start = ZONE_CONTENT2_X_START; x_end = ZONE_CONTENT2_X_END;
-      y_start = ZONE_CONTENT2_Y_START; y_end = ZONE_CONTENT2_Y_END;
-      break;
-    case ZONE_CONTENT3:
-      x_start = ZONE_CONTENT3_X_START; x_end = ZONE_CONTENT3_X_END;
-      y_start = ZONE_CONTENT3_Y_START; y_end = ZONE_CONTENT3_Y_END;
-      break;
-    default:
-      return;
+  if (!getZoneBounds(zone, &x_start, &y_start, &zoneW, &zoneH)) {
+    return;
   }
 
-  int zoneW = x_end - x_start + 1;
-  int zoneH = y_end - y_start + 1;
+  dmaFence();  // Direct TFT writes follow
+  metricsBegin(zone, RENDER_FN_CLEAR_ZONE);
+  metricsRecordPush(x_start, y_start, zoneW, zoneH);
 
 #if SPRITE_BG_ENABLED
   // Push sprite background
@@ -108,29 +96,29 @@ void clearZone(Zone zone) {
 
   // Future: Add custom calendar background here
   // if (currentScreen == SCREEN_CALENDAR && isContentZone) {
-  //   tft.pushImage(x_start, y_start, SPRITE_CAL_WIDTH, SPRITE_CAL_HEIGHT, SPRITE_CAL);
+  //   drawRleSprite(tft, x_start, y_start, SPRITE_CAL);
   // } else
   if (currentScreen == SCREEN_CALENDAR && isContentZone) {
     tft.fillRect(x_start, y_start, zoneW, zoneH, COLOR_BACKGROUND);
   } else {
     switch (zone) {
       case ZONE_TITLE:
-        tft.pushImage(x_start, y_start, SPRITE_TITLE_WIDTH, SPRITE_TITLE_HEIGHT, SPRITE_TITLE);
+        drawRleSprite(tft, x_start, y_start, SPRITE_TITLE);
         break;
       case ZONE_CLOCK:
-        tft.pushImage(x_start, y_start, SPRITE_CLOCK_WIDTH, SPRITE_CLOCK_HEIGHT, SPRITE_CLOCK);
+        drawRleSprite(tft, x_start, y_start, SPRITE_CLOCK);
         break;
       case ZONE_STATUS:
-        tft.pushImage(x_start, y_start, SPRITE_STATUS_WIDTH, SPRITE_STATUS_HEIGHT, SPRITE_STATUS);
+        drawRleSprite(tft, x_start, y_start, SPRITE_STATUS);
         break;
       case ZONE_CONTENT1:
-        tft.pushImage(x_start, y_start, SPRITE_CONTENT1_WIDTH, SPRITE_CONTENT1_HEIGHT, SPRITE_CONTENT1);
+        drawRleSprite(tft, x_start, y_start, SPRITE_CONTENT1);
         break;
       case ZONE_CONTENT2:
-        tft.pushImage(x_start, y_start, SPRITE_CONTENT2_WIDTH, SPRITE_CONTENT2_HEIGHT, SPRITE_CONTENT2);
+        drawRleSprite(tft, x_start, y_start, SPRITE_CONTENT2);
         break;
       case ZONE_CONTENT3:
-        tft.pushImage(x_start, y_start, SPRITE_CONTENT3_WIDTH, SPRITE_CONTENT3_HEIGHT, SPRITE_CONTENT3);
+        drawRleSprite(tft, x_start, y_start, SPRITE_CONTENT3);
         break;
       default:
         break;
@@ -145,18 +133,22 @@ void clearZone(Zone zone) {
   // Draw debug borders on top (reusing x_start, y_start, zoneW, zoneH from above)
   tft.drawRect(x_start, y_start, zoneW, zoneH, TFT_WHITE);
 #endif
+
+  metricsEnd();
 }
 
 // ==================== Zone Sprite Helper ====================
 /**
- * Prepare a sprite with background - either sprite image or solid fill
+ * Prepare a sprite with background - either sprite image or solid fill.
+ * Only the sprite's viewport is filled when one is set.
  * @param sprite    - TFT_eSprite to render into (must already be created)
- * @param bgSprite  - PROGMEM sprite array
- * @param bgW, bgH  - Sprite dimensions
+ * @param bg        - Compressed background for the zone
+ * @param bgX       - Sprite x of the background's left edge (sprites covering part of a zone)
  */
-void prepareZoneSprite(TFT_eSprite& sprite, const uint16_t* bgSprite, int bgW, int bgH) {
+void prepareZoneSprite(TFT_eSprite& sprite, const RleSprite& bg, int bgX = 0) {
+  metricsRecordSpriteFill(sprite.getViewportWidth(), sprite.getViewportHeight());
 #if SPRITE_BG_ENABLED
-  sprite.pushImage(0, 0, bgW, bgH, bgSprite);
+  drawRleSprite(sprite, bgX, 0, bg);
 #else
   sprite.fillSprite(COLOR_BACKGROUND);
 #endif
@@ -170,44 +162,48 @@ static const int TITLE_TEXT_Y = 5;
 // Clock zone text position
 static const int CLOCK_TEXT_X = 0;
 static const int CLOCK_TEXT_Y = 5;
+static const FontId CLOCK_FONT = FONT_REGULAR_9;  // Metrics for MDIOTrial_Regular9pt7b
 
 // ==================== Title Zone ====================
-static TFT_eSprite titleSprite = TFT_eSprite(&tft);
-static bool titleSpriteCreated = false;
-
-void drawTitle() {
-  // Create sprite once - use zone dimensions, not sprite header dimensions
+bool drawTitle() {
+  // Use zone dimensions, not sprite header dimensions
   static const int titleW = ZONE_TITLE_X_END - ZONE_TITLE_X_START + 1;
   static const int titleH = ZONE_TITLE_Y_END - ZONE_TITLE_Y_START + 1;
-  if (!titleSpriteCreated) {
-    titleSprite.createSprite(titleW, titleH);
-    titleSprite.setFreeFont(&MDIOTrial_Bold10pt7b);
-    titleSpriteCreated = true;
+  TFT_eSprite* titleSprite = leaseSprite(SPRITE_OWNER_TITLE, titleW, titleH, 16);
+  if (titleSprite == nullptr) {
+    return false;
   }
 
   // Prepare background (sprite or solid fill based on SPRITE_BG_ENABLED)
-  prepareZoneSprite(titleSprite, SPRITE_TITLE, SPRITE_TITLE_WIDTH, SPRITE_TITLE_HEIGHT);
+  prepareZoneSprite(*titleSprite, SPRITE_TITLE);
 
   // Overlay text
-  titleSprite.setTextSize(1);
-  titleSprite.setTextColor(COLOR_HEADER);
-  const char* title = (currentScreen == SCREEN_NOTIFS) ? "NOTIFS" : 
-                      (currentScreen == SCREEN_REMINDER ? "REMINDER" : "CALENDAR");
-  titleSprite.drawString(title, TITLE_TEXT_X, TITLE_TEXT_Y);
+  titleSprite->setFreeFont(&MDIOTrial_Bold10pt7b);
+  titleSprite->setTextSize(1);
+  titleSprite->setTextColor(COLOR_HEADER);
+  char title[16];
+  if (currentScreen == SCREEN_NOTIFS) {
+    notifTitle(title, sizeof(title));
+  } else {
+    strcpy(title, currentScreen == SCREEN_REMINDER ? "REMINDER" : "CALENDAR");
+  }
+  titleSprite->drawString(title, TITLE_TEXT_X, TITLE_TEXT_Y);
 
   // Push to screen
-  titleSprite.pushSprite(ZONE_TITLE_X_START, ZONE_TITLE_Y_START);
+  dmaPushSprite(*titleSprite, ZONE_TITLE_X_START, ZONE_TITLE_Y_START);
+  metricsRecordPush(ZONE_TITLE_X_START, ZONE_TITLE_Y_START, titleW, titleH);
+  releaseSprite(titleSprite);
 
 #if DEBUG_SHOW_ZONES
+  dmaFence();
   tft.drawRect(ZONE_TITLE_X_START, ZONE_TITLE_Y_START,
                ZONE_TITLE_X_END - ZONE_TITLE_X_START + 1,
                ZONE_TITLE_Y_END - ZONE_TITLE_Y_START + 1, TFT_WHITE);
 #endif
+  return true;
 }
 
 // ==================== Clock Zone ====================
-static TFT_eSprite clockSprite = TFT_eSprite(&tft);
-static bool clockSpriteCreated = false;
 static char previousTimeStr[25] = "";
 
 static void resetPreviousTimeStr() {
@@ -225,33 +221,64 @@ void updateClock() {
   if (strcmp(timeStr, previousTimeStr) == 0) {
     return;
   }
-  strcpy(previousTimeStr, timeStr);
+  metricsBegin(ZONE_CLOCK, RENDER_FN_CLOCK);
 
-  // Create sprite once - use zone dimensions, not sprite header dimensions
+  // Use zone dimensions, not sprite header dimensions
   static const int clockW = ZONE_CLOCK_X_END - ZONE_CLOCK_X_START + 1;
   static const int clockH = ZONE_CLOCK_Y_END - ZONE_CLOCK_Y_START + 1;
-  if (!clockSpriteCreated) {
-    clockSprite.createSprite(clockW, clockH);
-    clockSprite.setFreeFont(&MDIOTrial_Regular9pt7b);
-    clockSpriteCreated = true;
-  }
 
-  // Prepare background (sprite or solid fill based on SPRITE_BG_ENABLED)
-  prepareZoneSprite(clockSprite, SPRITE_CLOCK, SPRITE_CLOCK_WIDTH, SPRITE_CLOCK_HEIGHT);
+  // Repaint span in zone x: the whole text after a reset, otherwise only the
+  // cells of the characters that changed. Glyphs stay within their advance in
+  // this font, so unchanged neighbours never reach into the span.
+  int len = strlen(timeStr);
+  int spanX = 0;
+  int spanW = clockW;
+  int first = 0;
+  int end = len;
+  if (previousTimeStr[0] != '\0' && (int)strlen(previousTimeStr) == len) {
+    while (timeStr[first] == previousTimeStr[first]) first++;
+    while (timeStr[end - 1] == previousTimeStr[end - 1]) end--;
+    // A day or month name of a different width shifts everything after it
+    if (textAdvancePx(CLOCK_FONT, timeStr, end) != textAdvancePx(CLOCK_FONT, previousTimeStr, end)) {
+      end = len;
+    }
+    int oldEndX = textAdvancePx(CLOCK_FONT, previousTimeStr, end);
+    int newEndX = textAdvancePx(CLOCK_FONT, timeStr, end);
+    spanX = CLOCK_TEXT_X + textAdvancePx(CLOCK_FONT, timeStr, first);
+    spanW = min(CLOCK_TEXT_X + max(oldEndX, newEndX), clockW) - spanX;
+  }
 
-  // Overlay text
-  clockSprite.setTextSize(1);
-  clockSprite.setTextColor(COLOR_CLOCK);
-  clockSprite.drawString(timeStr, CLOCK_TEXT_X, CLOCK_TEXT_Y);
+  // The sprite only covers the span
+  TFT_eSprite* clockSprite = leaseSprite(SPRITE_OWNER_CLOCK, spanW, clockH, 16);
+  if (clockSprite == nullptr) {
+    metricsEnd();
+    return;  // previousTimeStr is unchanged, so the next call retries
+  }
+  strcpy(previousTimeStr, timeStr);
 
-  // Push to screen
-  clockSprite.pushSprite(ZONE_CLOCK_X_START, ZONE_CLOCK_Y_START);
+  // Background under the span, then just its characters
+  prepareZoneSprite(*clockSprite, SPRITE_CLOCK, -spanX);
+  clockSprite->setFreeFont(&MDIOTrial_Regular9pt7b);
+  clockSprite->setTextSize(1);
+  clockSprite->setTextColor(COLOR_CLOCK);
+  char cells[sizeof(previousTimeStr)];
+  memcpy(cells, timeStr + first, end - first);
+  cells[end - first] = '\0';
+  clockSprite->drawString(cells, CLOCK_TEXT_X + textAdvancePx(CLOCK_FONT, timeStr, first) - spanX,
+                          CLOCK_TEXT_Y);
+
+  dmaPushSprite(*clockSprite, ZONE_CLOCK_X_START + spanX, ZONE_CLOCK_Y_START);
+  metricsRecordPush(ZONE_CLOCK_X_START + spanX, ZONE_CLOCK_Y_START, spanW, clockH);
+  releaseSprite(clockSprite);
 
 #if DEBUG_SHOW_ZONES
+  dmaFence();
   tft.drawRect(ZONE_CLOCK_X_START, ZONE_CLOCK_Y_START,
                ZONE_CLOCK_X_END - ZONE_CLOCK_X_START + 1,
                ZONE_CLOCK_Y_END - ZONE_CLOCK_Y_START + 1, TFT_WHITE);
 #endif
+
+  metricsEnd();
 }
 // ==================== Status Zone (Now Playing / PC Stats) ====================
 // Sprites for flicker-free rendering - dimensions calculated from zone boundaries
@@ -265,15 +292,46 @@ static const int STATUS_RAM_OFFSET = 7;  // RAM pie chart x-offset from current
 static const int STATUS_RAM_RADIUS = 6;  // RAM pie chart radius
 static const int STATUS_RAM_WIDTH = 16;  // Total width reserved for RAM pie chart
 static const int STATUS_DISC_CX = 11;    // Disc icon center x
-static const int STATUS_DISC_RADIUS = 7; // Disc icon outer radius
-static const int STATUS_DISC_INNER = 2;  // Disc icon inner circle radius
+static const int STATUS_DISC_RADIUS = DISC_RADIUS; // Disc icon outer radius
 
-static TFT_eSprite npSprite = TFT_eSprite(&tft);       // Full status zone
-static TFT_eSprite textSprite = TFT_eSprite(&tft);     // Text-only zone
-static bool npSpriteCreated = false;
+static TFT_eSprite* npSprite = nullptr;  // Full status zone, leased while a frame is drawn
 static bool npZoneCleared = false;  // One-time zone clear
 
-void drawPcStats() {
+// RAM pie (outline + filled sector) cached as a row mask for the last percent drawn
+static const int RAM_PIE_SIZE = STATUS_RAM_RADIUS * 2 + 1;
+static uint16_t ramPieRows[RAM_PIE_SIZE];
+static int ramPieCachedPercent = -1;
+
+static void drawRamPie(int cx, int cy, int percent) {
+  const int r = STATUS_RAM_RADIUS;
+
+  if (percent != ramPieCachedPercent) {
+    TFT_eSprite* scratch = leaseSprite(SPRITE_OWNER_SCRATCH, RAM_PIE_SIZE, RAM_PIE_SIZE, 1);
+    if (scratch == nullptr) {
+      // No scratch sprite: draw straight into the status sprite
+      npSprite->drawCircle(cx, cy, r, COLOR_RAM);
+      fillArc(*npSprite, cx, cy, r, 0, 0, percent * 360 / 100, COLOR_RAM);
+      return;
+    }
+    scratch->fillSprite(TFT_BLACK);
+    // Fill pie segment (0 degrees = top, clockwise)
+    scratch->drawCircle(r, r, r, TFT_WHITE);
+    fillArc(*scratch, r, r, r, 0, 0, percent * 360 / 100, TFT_WHITE);
+    packRowMask(*scratch, ramPieRows, RAM_PIE_SIZE, RAM_PIE_SIZE, TFT_BLACK);
+    releaseSprite(scratch);
+    ramPieCachedPercent = percent;
+  }
+
+  drawRowMask(*npSprite, cx - r, cy - r, ramPieRows, RAM_PIE_SIZE, COLOR_RAM);
+}
+
+bool drawPcStats() {
+  metricsBegin(ZONE_STATUS, RENDER_FN_PC_STATS);
+
+  // One consistent sample for the whole bar
+  PcStats stats;
+  readPcStats(stats);
+
   const int zoneX = ZONE_STATUS_X_START;
   const int zoneY = ZONE_STATUS_Y_START;
   const int zoneW = STATUS_ZONE_W;
@@ -281,22 +339,22 @@ void drawPcStats() {
 
   // One-time zone clear
   if (!npZoneCleared) {
+    dmaFence();
     tft.fillRect(zoneX, zoneY, zoneW, zoneH, COLOR_BACKGROUND);
+    metricsRecordPush(zoneX, zoneY, zoneW, zoneH);
     npZoneCleared = true;
   }
 
-  // Create sprite if needed
-  if (!npSpriteCreated) {
-    npSprite.createSprite(zoneW, zoneH);
-    npSprite.setFreeFont(&MDIOTrial_Regular9pt7b);
-    textSprite.createSprite(zoneW - 22, zoneH);  // Text area after disc icon
-    textSprite.setFreeFont(&MDIOTrial_Regular9pt7b);
-    npSpriteCreated = true;
+  npSprite = leaseSprite(SPRITE_OWNER_STATUS, zoneW, zoneH, 16);
+  if (npSprite == nullptr) {
+    metricsEnd();
+    return false;
   }
+  npSprite->setFreeFont(&MDIOTrial_Regular9pt7b);
 
   // Prepare background (sprite or solid fill based on SPRITE_BG_ENABLED)
-  prepareZoneSprite(npSprite, SPRITE_STATUS, SPRITE_STATUS_WIDTH, SPRITE_STATUS_HEIGHT);
-  npSprite.setTextSize(1);
+  prepareZoneSprite(*npSprite, SPRITE_STATUS);
+  npSprite->setTextSize(1);
 
   int x = STATUS_TEXT_X;
   int y = STATUS_TEXT_Y;
@@ -305,8 +363,8 @@ void drawPcStats() {
 
   // Compact format: "65c 45% 4.2GHz | 72c 95% | 8G | ↓12↑2"
   // CPU stats - flash red if overheating, blue if sensor error (0)
-  bool cpuOverheat = (pcCpuTemp > CPU_TEMP_WARN);
-  bool cpuSensorError = (pcCpuTemp == 0);
+  bool cpuOverheat = (stats.cpuTemp > CPU_TEMP_WARN);
+  bool cpuSensorError = (stats.cpuTemp == 0);
 
   // Draw CPU temp - always show, flash blue if 0 (sensor error), red if overheating
   uint16_t cpuTempColor = COLOR_CPU;
@@ -315,104 +373,189 @@ void drawPcStats() {
   } else if (cpuOverheat && flashOn) {
     cpuTempColor = TFT_RED;   // Flash red for overheating
   }
-  npSprite.setTextColor(cpuTempColor);
+  npSprite->setTextColor(cpuTempColor);
   char cpuTempStr[8];
-  snprintf(cpuTempStr, sizeof(cpuTempStr), "%02dc ", pcCpuTemp);
-  npSprite.drawString(cpuTempStr, x, y);
-  x += npSprite.textWidth(cpuTempStr);
+  snprintf(cpuTempStr, sizeof(cpuTempStr), "%02dc ", stats.cpuTemp);
+  npSprite->drawString(cpuTempStr, x, y);
+  x += npSprite->textWidth(cpuTempStr);
 
   // Draw CPU usage and speed (always orange)
-  npSprite.setTextColor(COLOR_CPU);
+  npSprite->setTextColor(COLOR_CPU);
   char cpuRestStr[16];
-  snprintf(cpuRestStr, sizeof(cpuRestStr), " %02d%% %.1fGHz", pcCpuUsage, pcCpuSpeed);
-  npSprite.drawString(cpuRestStr, x, y);
-  x += npSprite.textWidth(cpuRestStr);
+  snprintf(cpuRestStr, sizeof(cpuRestStr), " %02d%% %.1fGHz", stats.cpuUsage, stats.cpuSpeed);
+  npSprite->drawString(cpuRestStr, x, y);
+  x += npSprite->textWidth(cpuRestStr);
 
   // Separator after CPU
-  npSprite.setTextColor(COLOR_SEP);
-  npSprite.drawString("| ", x, y);
-  x += npSprite.textWidth("| ");
+  npSprite->setTextColor(COLOR_SEP);
+  npSprite->drawString("| ", x, y);
+  x += npSprite->textWidth("| ");
 
   // RAM as pie chart (moved before GPU)
   int ramCx = x + STATUS_RAM_OFFSET;
   int ramCy = zoneH / 2 - 1;  // Move up 1px to align with text
-  int ramRadius = STATUS_RAM_RADIUS;
-  float ramPercent = (pcRamTotal > 0) ? (float)pcRamUsed / pcRamTotal : 0;
-  int ramAngle = (int)(ramPercent * 360);
-
-  // Draw empty circle
-  npSprite.drawCircle(ramCx, ramCy, ramRadius, COLOR_RAM);
-  // Fill pie segment (0 degrees = top, clockwise)
-  if (ramAngle > 0) {
-    for (int a = -90; a < -90 + ramAngle; a++) {
-      float rad = a * PI / 180.0;
-      int px = ramCx + (int)(ramRadius * cos(rad));
-      int py = ramCy + (int)(ramRadius * sin(rad));
-      npSprite.drawLine(ramCx, ramCy, px, py, COLOR_RAM);
-    }
-  }
+  int ramPercent = (stats.ramTotal > 0) ? constrain(stats.ramUsed * 100 / stats.ramTotal, 0, 100) : 0;
+  drawRamPie(ramCx, ramCy, ramPercent);
   x += STATUS_RAM_WIDTH;  // Pie chart width
 
   // Separator after RAM
-  npSprite.setTextColor(COLOR_SEP);
-  npSprite.drawString("| ", x, y);
-  x += npSprite.textWidth("| ");
+  npSprite->setTextColor(COLOR_SEP);
+  npSprite->drawString("| ", x, y);
+  x += npSprite->textWidth("| ");
 
   // GPU stats - only flash temp red, keep usage magenta
-  bool gpuOverheat = (pcGpuTemp > GPU_TEMP_WARN);
+  bool gpuOverheat = (stats.gpuTemp > GPU_TEMP_WARN);
 
   // Draw GPU temp (flashing if overheating)
   uint16_t gpuTempColor = (gpuOverheat && flashOn) ? TFT_RED : COLOR_GPU;
-  npSprite.setTextColor(gpuTempColor);
+  npSprite->setTextColor(gpuTempColor);
   char gpuTempStr[8];
-  snprintf(gpuTempStr, sizeof(gpuTempStr), "%02dc ", pcGpuTemp);
-  npSprite.drawString(gpuTempStr, x, y);
-  x += npSprite.textWidth(gpuTempStr);
+  snprintf(gpuTempStr, sizeof(gpuTempStr), "%02dc ", stats.gpuTemp);
+  npSprite->drawString(gpuTempStr, x, y);
+  x += npSprite->textWidth(gpuTempStr);
 
   // Draw GPU usage (always magenta)
-  npSprite.setTextColor(COLOR_GPU);
+  npSprite->setTextColor(COLOR_GPU);
   char gpuUsageStr[8];
-  snprintf(gpuUsageStr, sizeof(gpuUsageStr), " %02d%%", pcGpuUsage);
-  npSprite.drawString(gpuUsageStr, x, y);
-  x += npSprite.textWidth(gpuUsageStr);
+  snprintf(gpuUsageStr, sizeof(gpuUsageStr), " %02d%%", stats.gpuUsage);
+  npSprite->drawString(gpuUsageStr, x, y);
+  x += npSprite->textWidth(gpuUsageStr);
 
   // Separator after GPU
-  npSprite.setTextColor(COLOR_SEP);
-  npSprite.drawString("|", x, y);
-  x += npSprite.textWidth("|");
+  npSprite->setTextColor(COLOR_SEP);
+  npSprite->drawString("|", x, y);
+  x += npSprite->textWidth("|");
 
   // Network: Download speed - compact format (always ~3 chars)
   // < 1M: .xM | 1-99M: xxM | 100-999M: .xG | ≥1000M: xG
-  npSprite.setTextColor(COLOR_NET);
+  npSprite->setTextColor(COLOR_NET);
   char downStr[8];
-  if (pcNetDown >= 1000) {
+  if (stats.netDown >= 1000) {
     // ≥1 Gbps: show as xG (1G, 2G, etc.)
-    snprintf(downStr, sizeof(downStr), "%.0fG", pcNetDown / 1000);
-  } else if (pcNetDown >= 100) {
+    snprintf(downStr, sizeof(downStr), "%.0fG", stats.netDown / 1000);
+  } else if (stats.netDown >= 100) {
     // 100-999 Mbps: show as .xG (.1G, .3G, .9G)
-    int decimal = (int)(pcNetDown / 100) % 10;
+    int decimal = (int)(stats.netDown / 100) % 10;
     snprintf(downStr, sizeof(downStr), ".%dG", decimal);
-  } else if (pcNetDown > 0.9) {
+  } else if (stats.netDown > 0.9) {
     // 1-99 Mbps: show as integer (1M, 12M, 99M)
-    snprintf(downStr, sizeof(downStr), "%.0fM", pcNetDown);
+    snprintf(downStr, sizeof(downStr), "%.0fM", stats.netDown);
   } else {
     // < 1 Mbps: show as .xM (.0M, .5M, .9M)
-    int decimal = (int)(pcNetDown * 10) % 10;
+    int decimal = (int)(stats.netDown * 10) % 10;
     snprintf(downStr, sizeof(downStr), ".%dM", decimal);
   }
-  npSprite.drawString(downStr, x, y);
+  npSprite->drawString(downStr, x, y);
 
 #if DEBUG_SHOW_ZONES
-  npSprite.drawRect(0, 0, zoneW, zoneH, TFT_WHITE);
+  npSprite->drawRect(0, 0, zoneW, zoneH, TFT_WHITE);
 #endif
 
   // Push to screen at status zone position
-  npSprite.pushSprite(ZONE_STATUS_X_START, ZONE_STATUS_Y_START);
+  dmaPushSprite(*npSprite, ZONE_STATUS_X_START, ZONE_STATUS_Y_START);
+  metricsRecordPush(ZONE_STATUS_X_START, ZONE_STATUS_Y_START, zoneW, zoneH);
+  releaseSprite(npSprite);
+  npSprite = nullptr;
+
+  metricsEnd();
+  return true;
 }
 
-void drawNowPlaying() {
+// ==================== Now Playing Ticker Strip ====================
+/**
+ * The scrolling "song - artist" text is rasterised once per track into a
+ * 1-bit mask (MSB-first, tickerStride bytes per row). Each frame copies the
+ * visible window of the mask over the status background, a row span at a
+ * time, instead of re-rendering the glyphs. The mask is a fixed buffer sized
+ * for the longest song and artist a command can carry; if the scratch sprite
+ * cannot be leased, frames fall back to drawString() with the cached text.
+ */
+static const int TICKER_MAX_CHARS = 2 * (COMMAND_TEXT_CHARS - 1) + 3 + 4;  // "song - artist" + gap
+static const int TICKER_MAX_W = TICKER_MAX_CHARS * 12;  // Widest MDIOTrial_Regular9pt7b advance
+static const int TICKER_MASK_BYTES = (TICKER_MAX_W + 7) / 8 * STATUS_ZONE_H;
+
+static String tickerText;                 // Padded text incl. gap before repeat
+static uint8_t tickerMask[TICKER_MASK_BYTES];
+static bool tickerMasked = false;         // tickerMask holds tickerText
+static int tickerTextW = 0;               // Text width in pixels
+static int tickerStride = 0;              // Mask bytes per row
+static bool tickerValid = false;
+
+void invalidateNowPlayingStrip() {
+  tickerValid = false;
+}
+
+static void buildTickerStrip() {
+  tickerMasked = false;
+  tickerValid = true;
+
+  tickerText = nowPlayingSong;
+  if (nowPlayingArtist.length() > 0) {
+    tickerText += " - " + nowPlayingArtist;
+  }
+
+  // Pad to minimum length if smaller (user request for better spacing)
+  while (tickerText.length() < NOW_PLAYING_MIN_CHARS) {
+    tickerText += " ";
+  }
+  tickerText += "    ";  // Gap before repeat
+
+  tickerTextW = npSprite->textWidth(tickerText);
+  tickerStride = (tickerTextW + 7) / 8;
+
+  // Rasterise into a temporary 1-bit sprite, then pack it into the mask
+  TFT_eSprite* scratch = leaseSprite(SPRITE_OWNER_SCRATCH, tickerTextW, STATUS_ZONE_H, 1);
+  if (scratch == nullptr) {
+    Serial.println("Ticker strip: sprite alloc failed, drawing text per frame");
+    return;
+  }
+  if (tickerStride * STATUS_ZONE_H > TICKER_MASK_BYTES) {
+    Serial.println("Ticker strip: text too wide for the mask, drawing text per frame");
+    releaseSprite(scratch);
+    return;
+  }
+  memset(tickerMask, 0, tickerStride * STATUS_ZONE_H);
+
+  scratch->fillSprite(TFT_BLACK);
+  scratch->setFreeFont(&MDIOTrial_Regular9pt7b);
+  scratch->setTextSize(1);
+  scratch->setTextColor(TFT_WHITE);
+  scratch->drawString(tickerText, 0, STATUS_TEXT_Y);
+
+  for (int y = 0; y < STATUS_ZONE_H; y++) {
+    uint8_t* row = tickerMask + y * tickerStride;
+    for (int x = 0; x < tickerTextW; x++) {
+      if (scratch->readPixel(x, y) != TFT_BLACK) {
+        row[x >> 3] |= 0x80 >> (x & 7);
+      }
+    }
+  }
+  releaseSprite(scratch);
+  tickerMasked = true;
+}
+
+// Copy the ticker text with its left edge at dstX, clipped to npSprite
+static void drawTickerText(int dstX) {
+  if (!tickerMasked) {
+    npSprite->setTextColor(COLOR_NOW_PLAYING);
+    npSprite->drawString(tickerText, dstX, STATUS_TEXT_Y);
+    return;
+  }
+
+  // Visible columns, widened left to a byte boundary (the sprite clips the extra)
+  int x0 = max(0, -dstX) & ~7;
+  int x1 = min(tickerTextW, STATUS_ZONE_W - dstX);
+  if (x0 >= x1) {
+    return;
+  }
+  // Each row goes in as its set runs, one drawFastHLine span per run
+  drawBitMask(*npSprite, dstX + x0, 0, tickerMask + (x0 >> 3), tickerStride, x1 - x0,
+              STATUS_ZONE_H, COLOR_NOW_PLAYING);
+}
+
+bool drawNowPlaying() {
   // Check if PC stats are stale (PC went to sleep)
-  bool pcStatsStale = (millis() - pcStatsUpdated) > PC_STATS_TIMEOUT;
+  bool pcStatsStale = !pcStatsFresh();
 
   // Priority: Music → Media, Active Stats → Stats, Stale/Idle → Idle Disc
   // 1. If music is playing, show Now Playing
@@ -421,8 +564,7 @@ void drawNowPlaying() {
   if (nowPlayingActive) {
     // Continue to draw now playing below
   } else if (!pcStatsStale) {
-    drawPcStats();
-    return;
+    return drawPcStats();
   }
   // If we get here with stale stats and no music, show idle disc
 
@@ -430,32 +572,32 @@ void drawNowPlaying() {
   const int zoneY = ZONE_STATUS_Y_START;
   const int zoneW = STATUS_ZONE_W;
   const int zoneH = STATUS_ZONE_H;
-  const int textZoneX = NOW_PLAYING_TEXT_X;  // 22 (after disc icon)
-  const int textZoneW = zoneW - textZoneX;   // Remaining width for text
-
   // One-time zone clear to remove setup messages (WiFi OK, etc)
   if (!npZoneCleared) {
+    dmaFence();
     tft.fillRect(zoneX, zoneY, zoneW, zoneH, COLOR_BACKGROUND);
+    metricsRecordPush(zoneX, zoneY, zoneW, zoneH);
     npZoneCleared = true;
   }
 
-  // Create sprites once
-  if (!npSpriteCreated) {
-    npSprite.createSprite(zoneW, zoneH);
-    npSprite.setFreeFont(&MDIOTrial_Regular9pt7b);
-    textSprite.createSprite(textZoneW, zoneH);
-    textSprite.setFreeFont(&MDIOTrial_Regular9pt7b);
-    npSpriteCreated = true;
+  npSprite = leaseSprite(SPRITE_OWNER_STATUS, zoneW, zoneH, 16);
+  if (npSprite == nullptr) {
+    return false;
   }
+  npSprite->setFreeFont(&MDIOTrial_Regular9pt7b);
 
   // Prepare background (sprite or solid fill based on SPRITE_BG_ENABLED)
-  prepareZoneSprite(npSprite, SPRITE_STATUS, SPRITE_STATUS_WIDTH, SPRITE_STATUS_HEIGHT);
+  prepareZoneSprite(*npSprite, SPRITE_STATUS);
 
   // Album art dimensions with 1px border
-  const int artBoxSize = ALBUM_ART_SIZE + 2;  // 20px total with border
   const int artInnerOffset = 1;  // 1px border offset
   const int artTextGap = 4;  // Gap between art and text
 
+  // Rebuild the text strip after a track change
+  if (nowPlayingActive && !tickerValid) {
+    buildTickerStrip();
+  }
+
   // Draw album art if playing and valid, otherwise draw disc
   if (nowPlayingActive && albumArtValid) {
     // ==== Album art + text scroll together ====
@@ -465,20 +607,8 @@ void drawNowPlaying() {
     const int boxW = artW + 2;  // 1px border each side
     const int boxH = artH + 2;  // Should always be 20 (18 + 2)
 
-    String fullText = nowPlayingSong;
-    if (nowPlayingArtist.length() > 0) {
-      fullText += " - " + nowPlayingArtist;
-    }
-
-    // Pad to minimum length if smaller (user request for better spacing)
-    while (fullText.length() < NOW_PLAYING_MIN_CHARS) {
-      fullText += " ";
-    }
-    fullText += "    ";  // Gap before repeat
-
     // Calculate total content width (art box + gap + text)
-    int textWidth = npSprite.textWidth(fullText);
-    int totalWidth = boxW + artTextGap + textWidth;
+    int totalWidth = boxW + artTextGap + tickerTextW;
 
     // Wrap scroll position
     int scrollPixel = nowPlayingScrollPixel % totalWidth;
@@ -490,34 +620,21 @@ void drawNowPlaying() {
     int drawX = contentX;
     while (drawX < zoneW) {
       // Art box with variable width
-      npSprite.drawRect(drawX, 0, boxW, boxH, TFT_WHITE);
-      npSprite.pushImage(drawX + artInnerOffset, artInnerOffset, artW, artH, albumArt);
+      npSprite->drawRect(drawX, 0, boxW, boxH, TFT_WHITE);
+      npSprite->pushImage(drawX + artInnerOffset, artInnerOffset, artW, artH, albumArt);
       // Text after art
-      npSprite.setTextColor(COLOR_NOW_PLAYING);
-      npSprite.drawString(fullText, drawX + boxW + artTextGap, STATUS_TEXT_Y);
+      drawTickerText(drawX + boxW + artTextGap);
 
       drawX += totalWidth;
     }
   } else if (nowPlayingActive && nowPlayingSong.length() > 0) {
     // ==== Disc + text scroll together (no album art) ====
-    String fullText = nowPlayingSong;
-    if (nowPlayingArtist.length() > 0) {
-      fullText += " - " + nowPlayingArtist;
-    }
-
-    // Pad to minimum length if smaller
-    while (fullText.length() < NOW_PLAYING_MIN_CHARS) {
-      fullText += " ";
-    }
-    fullText += "    ";
-
     // Disc size constants
     const int discBoxSize = (STATUS_DISC_RADIUS * 2) + 2;  // Bounding box for disc
     const int discTextGap = 4;  // Gap between disc and text
 
     // Calculate total content width (disc + gap + text)
-    int textWidth = npSprite.textWidth(fullText);
-    int totalWidth = discBoxSize + discTextGap + textWidth;
+    int totalWidth = discBoxSize + discTextGap + tickerTextW;
 
     // Wrap scroll position
     int scrollPixel = nowPlayingScrollPixel % totalWidth;
@@ -532,31 +649,11 @@ void drawNowPlaying() {
     while (drawX < zoneW) {
       int cx = drawX + STATUS_DISC_RADIUS + 1;
 
-      // Spinning disc
-      float angle = (discFrame * 5.625) * PI / 180.0;
-      npSprite.drawCircle(cx, cy, STATUS_DISC_RADIUS, discColor);
-      npSprite.fillCircle(cx, cy, STATUS_DISC_INNER, discColor);
-
-      int t1x1 = cx + (int)(3 * cos(angle));
-      int t1y1 = cy + (int)(3 * sin(angle));
-      int t1x2 = cx + (int)(6 * cos(angle - 0.4));
-      int t1y2 = cy + (int)(6 * sin(angle - 0.4));
-      int t1x3 = cx + (int)(6 * cos(angle + 0.4));
-      int t1y3 = cy + (int)(6 * sin(angle + 0.4));
-      npSprite.fillTriangle(t1x1, t1y1, t1x2, t1y2, t1x3, t1y3, discColor);
-
-      float angle2 = angle + PI;
-      int t2x1 = cx + (int)(3 * cos(angle2));
-      int t2y1 = cy + (int)(3 * sin(angle2));
-      int t2x2 = cx + (int)(6 * cos(angle2 - 0.4));
-      int t2y2 = cy + (int)(6 * sin(angle2 - 0.4));
-      int t2x3 = cx + (int)(6 * cos(angle2 + 0.4));
-      int t2y3 = cy + (int)(6 * sin(angle2 + 0.4));
-      npSprite.fillTriangle(t2x1, t2y1, t2x2, t2y2, t2x3, t2y3, discColor);
+      // Spinning disc (pre-rendered frame)
+      drawDiscFrame(*npSprite, cx, cy, discFrame, discColor);
 
       // Text after disc
-      npSprite.setTextColor(COLOR_NOW_PLAYING);
-      npSprite.drawString(fullText, drawX + discBoxSize + discTextGap, STATUS_TEXT_Y);
+      drawTickerText(drawX + discBoxSize + discTextGap);
 
       drawX += totalWidth;
     }
@@ -566,40 +663,30 @@ void drawNowPlaying() {
     int cy = zoneH / 2;
     uint16_t discColor = TFT_WHITE;
 
-    npSprite.drawCircle(cx, cy, STATUS_DISC_RADIUS, discColor);
-    npSprite.fillCircle(cx, cy, STATUS_DISC_INNER, discColor);
-
-    float angle = (discFrame * 5.625) * PI / 180.0;
-    int t1x1 = cx + (int)(3 * cos(angle));
-    int t1y1 = cy + (int)(3 * sin(angle));
-    int t1x2 = cx + (int)(6 * cos(angle - 0.4));
-    int t1y2 = cy + (int)(6 * sin(angle - 0.4));
-    int t1x3 = cx + (int)(6 * cos(angle + 0.4));
-    int t1y3 = cy + (int)(6 * sin(angle + 0.4));
-    npSprite.fillTriangle(t1x1, t1y1, t1x2, t1y2, t1x3, t1y3, discColor);
-
-    float angle2 = angle + PI;
-    int t2x1 = cx + (int)(3 * cos(angle2));
-    int t2y1 = cy + (int)(3 * sin(angle2));
-    int t2x2 = cx + (int)(6 * cos(angle2 - 0.4));
-    int t2y2 = cy + (int)(6 * sin(angle2 - 0.4));
-    int t2x3 = cx + (int)(6 * cos(angle2 + 0.4));
-    int t2y3 = cy + (int)(6 * sin(angle2 + 0.4));
-    npSprite.fillTriangle(t2x1, t2y1, t2x2, t2y2, t2x3, t2y3, discColor);
+    drawDiscFrame(*npSprite, cx, cy, discFrame, discColor);
   }
 
 #if DEBUG_SHOW_ZONES
-  npSprite.drawRect(0, 0, zoneW, zoneH, TFT_WHITE);
+  npSprite->drawRect(0, 0, zoneW, zoneH, TFT_WHITE);
 #endif
 
   // Push to screen atomically at status zone position
-  npSprite.pushSprite(zoneX, zoneY);
+  dmaPushSprite(*npSprite, zoneX, zoneY);
+  metricsRecordPush(zoneX, zoneY, zoneW, zoneH);
+  releaseSprite(npSprite);
+  npSprite = nullptr;
+  return true;
 }
 
 // ==================== Now Playing Ticker Update ====================
 void updateNowPlayingTicker() {
   unsigned long now = millis();
 
+  // Static idle (power.h): the idle disc stays where it is
+  if (!nowPlayingActive && staticIdleActive()) {
+    return;
+  }
+
   // Always update disc animation (spinning even when not playing)
   // Now playing: CCW to match right-to-left text scroll
   // Idle: rotation matches movement direction
@@ -662,50 +749,157 @@ void updateNowPlayingTicker() {
   }
 }
 
+// Time until updateNowPlayingTicker() next has a step to take
+static uint32_t msUntil(unsigned long last, unsigned long interval) {
+  unsigned long elapsed = millis() - last;
+  return elapsed >= interval ? 0 : interval - elapsed;
+}
 
-// ==================== Main Refresh ====================
-void refreshScreen() {
-  // Title zone
-  if (isZoneDirty(ZONE_TITLE)) {
-    clearZone(ZONE_TITLE);
-    drawTitle();
-    resetPreviousTimeStr();  // Force clock redraw after title change
-    clearZoneDirty(ZONE_TITLE);
+uint32_t nowPlayingTickerWaitMs() {
+  if (!nowPlayingActive && staticIdleActive()) {
+    return UINT32_MAX;
+  }
+  uint32_t wait = msUntil(lastDiscUpdate, NOW_PLAYING_DISC_SPEED);
+  if (!nowPlayingActive) {
+    wait = min(wait, msUntil(lastIdleDiscMove, IDLE_DISC_TRAVEL_SPEED));
+  } else if (nowPlayingSong.length() > 0) {
+    wait = min(wait, msUntil(lastScrollUpdate, NOW_PLAYING_SCROLL_SPEED));
   }
+  return wait;
+}
 
-  // Clock zone
+// ==================== Zone Refresh ====================
+void refreshTitleZone() {
+  if (!isZoneDirty(ZONE_TITLE)) {
+    return;
+  }
+  clearZone(ZONE_TITLE);
+  metricsBegin(ZONE_TITLE, RENDER_FN_TITLE);
+  bool drawn = drawTitle();
+  metricsEnd();
+  if (!drawn) {
+    return;  // No sprite available: stay dirty and retry next frame
+  }
+  resetPreviousTimeStr();  // Force clock redraw after title change
+  clearZoneDirty(ZONE_TITLE);
+}
+
+void refreshClockZone() {
   if (isZoneDirty(ZONE_CLOCK)) {
     clearZone(ZONE_CLOCK);
     resetPreviousTimeStr();  // Force updateClock to redraw all characters
     clearZoneDirty(ZONE_CLOCK);
   }
+  updateClock();
+}
 
-  // Status zone (Now Playing) - no clearZone, drawNowPlaying handles its own updates
-  if (isZoneDirty(ZONE_STATUS)) {
-    drawNowPlaying();
-    clearZoneDirty(ZONE_STATUS);
+// Status zone (Now Playing) - no clearZone, drawNowPlaying handles its own updates
+void refreshStatusZone() {
+  if (!isZoneDirty(ZONE_STATUS)) {
+    return;
+  }
+  metricsBegin(ZONE_STATUS, RENDER_FN_NOW_PLAYING);
+  bool drawn = drawNowPlaying();
+  metricsEnd();
+  if (!drawn) {
+    return;  // No sprite available: stay dirty and retry next frame
   }
+  clearZoneDirty(ZONE_STATUS);
+}
 
-  // Content zones (check all 3)
-  bool anyContentDirty = isZoneDirty(ZONE_CONTENT1) || isZoneDirty(ZONE_CONTENT2) || isZoneDirty(ZONE_CONTENT3);
-  if (anyContentDirty) {
-    // Clear all dirty content zones
-    if (isZoneDirty(ZONE_CONTENT1)) clearZone(ZONE_CONTENT1);
-    if (isZoneDirty(ZONE_CONTENT2)) clearZone(ZONE_CONTENT2);
-    if (isZoneDirty(ZONE_CONTENT3)) clearZone(ZONE_CONTENT3);
+bool isContentDirty() {
+  return isZoneDirty(ZONE_CONTENT1) || isZoneDirty(ZONE_CONTENT2) || isZoneDirty(ZONE_CONTENT3);
+}
 
-    // Normal content drawing
-    if (currentScreen == SCREEN_NOTIFS) {
-      drawNotifContent();
-    } else if (currentScreen == SCREEN_REMINDER) {
-      drawReminderContent();
-    } else {
-      drawCalendarContent();
+// Zone backgrounds under the canvas viewport
+static void drawContentBackground(TFT_eSPI& canvas, int originY) {
+  static const RleSprite* const backgrounds[] = {&SPRITE_CONTENT1, &SPRITE_CONTENT2, &SPRITE_CONTENT3};
+  metricsRecordSpriteFill(canvas.getViewportWidth(), canvas.getViewportHeight());
+
+  for (int z = ZONE_CONTENT1; z <= ZONE_CONTENT3; z++) {
+    int zx, zy, zw, zh;
+    getZoneBounds((Zone)z, &zx, &zy, &zw, &zh);
+#if SPRITE_BG_ENABLED
+    drawRleSpriteRuns(canvas, zx, zy - originY, *backgrounds[z - ZONE_CONTENT1], contentInk);
+#else
+    canvas.fillRect(zx, zy - originY, zw, zh, contentInk(COLOR_BACKGROUND));
+#endif
+#if DEBUG_SHOW_ZONES
+    canvas.drawRect(zx, zy - originY, zw, zh, contentInk(TFT_WHITE));
+#endif
+  }
+}
+
+static RenderFn contentRenderFn() {
+  if (currentScreen == SCREEN_NOTIFS) return RENDER_FN_NOTIFS;
+  if (currentScreen == SCREEN_REMINDER) return RENDER_FN_REMINDERS;
+  return RENDER_FN_CALENDAR;
+}
+
+static void drawContent() {
+  if (currentScreen == SCREEN_NOTIFS) {
+    drawNotifContent();
+  } else if (currentScreen == SCREEN_REMINDER) {
+    drawReminderContent();
+  } else {
+    drawCalendarContent();
+  }
+}
+
+void refreshContentZones() {
+  // Content zones: repaint only the damaged rects. Rects from the three zones
+  // are merged first so full-zone damage becomes a single band.
+  DamageRect contentRects[3 * MAX_DAMAGE_RECTS];
+  uint8_t contentCount = 0;
+  for (int z = ZONE_CONTENT1; z <= ZONE_CONTENT3; z++) {
+    for (int i = 0; i < zoneDamage[z].count; i++) {
+      addDamageRect(contentRects, &contentCount, 3 * MAX_DAMAGE_RECTS, zoneDamage[z].rects[i]);
     }
+    clearZoneDirty((Zone)z);
+  }
+
+  // Draw once into the canvas (clipped to the damage), then push each rect
+  bool intact;
+  if (beginContentCanvas(contentRects, contentCount, &intact)) {
+    metricsBegin(ZONE_CONTENT1, contentRenderFn());
+    if (currentScreen != SCREEN_CALENDAR) {
+      setContentCanvasTag(0);
+      drawContentBackground(contentCanvas(), contentOriginY());
+    }
+    drawContent();
+    endContentCanvas();
+    metricsEnd();
+    return;
+  }
+
+  // No canvas: draw straight to the TFT, clipped to one rect at a time
+  for (int i = 0; i < contentCount; i++) {
+    const DamageRect& r = contentRects[i];
+
+    // Background and foreground are both clipped to the rect
+    tft.setViewport(r.x, r.y, r.w, r.h, false);
+    metricsSetClip(r.x, r.y, r.w, r.h);
 
-    // Clear all dirty flags
-    clearZoneDirty(ZONE_CONTENT1);
-    clearZoneDirty(ZONE_CONTENT2);
-    clearZoneDirty(ZONE_CONTENT3);
+    for (int z = ZONE_CONTENT1; z <= ZONE_CONTENT3; z++) {
+      int zx, zy, zw, zh;
+      getZoneBounds((Zone)z, &zx, &zy, &zw, &zh);
+      if (r.x < zx + zw && zx < r.x + r.w && r.y < zy + zh && zy < r.y + r.h) {
+        clearZone((Zone)z);
+      }
+    }
+    metricsBegin(ZONE_CONTENT1, contentRenderFn());
+    drawContent();
+    metricsEnd();
+
+    metricsClearClip();
+    tft.resetViewport();
   }
 }
+
+// ==================== Main Refresh ====================
+void refreshScreen() {
+  refreshTitleZone();
+  refreshClockZone();
+  refreshStatusZone();
+  refreshContentZones();
+}
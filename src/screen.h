@@ -8,11 +8,21 @@ extern TFT_eSPI tft;
 
 void initScreen();
 void drawDebugZones();  // Debug: draw white zone boundaries
-void refreshScreen();
+void refreshScreen();  // Every dirty zone at once (startup)
+
+// Per-zone refresh, run by the frame scheduler
+void refreshTitleZone();
+void refreshClockZone();  // Repaints a damaged clock zone, then updates the time
+void refreshStatusZone();
+void refreshContentZones();
+bool isContentDirty();
+
 void updateClock();
 void clearZone(Zone zone);
-void drawTitle();
-void drawNowPlaying();
+bool drawTitle();  // false if no sprite could be leased
+bool drawNowPlaying();  // false if no sprite could be leased
 void updateNowPlayingTicker();
+uint32_t nowPlayingTickerWaitMs();  // Until the ticker's next step (render task sleep)
+void invalidateNowPlayingStrip();  // Call when the song/artist changes
 
 #endif
@@ -0,0 +1,53 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * One writer task publishes a plain struct, any task reads a consistent
+ * copy: the same seqlock pc_stats.cpp and render_metrics.cpp use, for the
+ * counter reports that HTTP handlers serve. T must be plain data and a whole
+ * number of words.
+ */
+template <typename T>
+class Seqlock {
+ public:
+  static const int WORDS = sizeof(T) / sizeof(uint32_t);
+  static_assert(sizeof(T) % sizeof(uint32_t) == 0, "Seqlock payload must be whole words");
+
+  // Writer task only
+  void publish(const T& value) {
+    const uint32_t* src = (const uint32_t*)&value;
+    uint32_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);  // Odd before any word
+    for (int i = 0; i < WORDS; i++) {
+      words[i].store(src[i], std::memory_order_relaxed);
+    }
+    sequence.store(seq + 2, std::memory_order_release);  // Words before even
+  }
+
+  // Any task; zeroes until the first publish
+  void read(T& out) const {
+    uint32_t* dst = (uint32_t*)&out;
+    for (;;) {
+      uint32_t before = sequence.load(std::memory_order_acquire);
+      if (before & 1) continue;
+      for (int i = 0; i < WORDS; i++) {
+        dst[i] = words[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);  // Words before the re-check
+      if (sequence.load(std::memory_order_relaxed) == before) {
+        return;
+      }
+    }
+  }
+
+ private:
+  std::atomic<uint32_t> sequence{0};  // Odd while the writer is storing words
+  // Atomics so a torn read is a retry, not undefined behaviour
+  std::atomic<uint32_t> words[WORDS] = {};
+};
+
+#endif
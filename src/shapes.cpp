@@ -0,0 +1,147 @@
+#include "shapes.h"
+
+// ==================== Integer Trig ====================
+// sin(0..90 degrees) * 1024
+static const int16_t SIN_TABLE[91] = {
+     0,   18,   36,   54,   71,   89,  107,  125,  143,  160,
+   178,  195,  213,  230,  248,  265,  282,  299,  316,  333,
+   350,  367,  384,  400,  416,  433,  449,  465,  481,  496,
+   512,  527,  543,  558,  573,  587,  602,  616,  630,  644,
+   658,  672,  685,  698,  711,  724,  737,  749,  761,  773,
+   784,  796,  807,  818,  828,  839,  849,  859,  868,  878,
+   887,  896,  904,  912,  920,  928,  935,  943,  949,  956,
+   962,  968,  974,  979,  984,  989,  994,  998, 1002, 1005,
+  1008, 1011, 1014, 1016, 1018, 1020, 1022, 1023, 1023, 1024,
+  1024
+};
+
+static int32_t isin(int deg) {
+  deg = ((deg % 360) + 360) % 360;
+  if (deg <= 90) return SIN_TABLE[deg];
+  if (deg <= 180) return SIN_TABLE[180 - deg];
+  if (deg <= 270) return -SIN_TABLE[deg - 180];
+  return -SIN_TABLE[360 - deg];
+}
+
+static int32_t icos(int deg) {
+  return isin(deg + 90);
+}
+
+static int isqrt(int32_t v) {
+  if (v <= 0) return 0;
+  int x = 0;
+  while ((int32_t)(x + 1) * (x + 1) <= v) x++;
+  return x;
+}
+
+// ==================== Filled Arcs ====================
+void fillArc(TFT_eSPI& canvas, int cx, int cy, int outerR, int innerR,
+             int startAngle, int endAngle, uint32_t color) {
+  int sweep = endAngle - startAngle;
+  if (outerR <= 0 || sweep <= 0) {
+    return;
+  }
+  if (innerR < 0) innerR = 0;
+  if (innerR >= outerR) return;
+
+  // Edge directions in screen space (y down); 0 degrees points up
+  const bool full = sweep >= 360;
+  const bool wide = sweep > 180;
+  const int32_t sx = isin(startAngle), sy = -icos(startAngle);
+  const int32_t ex = isin(endAngle), ey = -icos(endAngle);
+
+  // r*r + r matches the midpoint circle drawn by drawCircle()
+  const int32_t outer2 = (int32_t)outerR * outerR + outerR;
+  const int32_t inner2 = innerR > 0 ? (int32_t)innerR * innerR + innerR : -1;
+
+  for (int dy = -outerR; dy <= outerR; dy++) {
+    int32_t dy2 = (int32_t)dy * dy;
+    int xo = isqrt(outer2 - dy2);
+    int xi = (inner2 >= dy2) ? isqrt(inner2 - dy2) : -1;  // Hole spans -xi..xi
+
+    int runStart = 0;
+    bool inRun = false;
+    for (int dx = -xo; dx <= xo + 1; dx++) {
+      bool inside = false;
+      if (dx <= xo && (dx < -xi || dx > xi)) {
+        if (full) {
+          inside = true;
+        } else {
+          int32_t cs = sx * dy - sy * dx;  // >= 0: clockwise of start edge
+          int32_t ce = dx * ey - dy * ex;  // >= 0: anticlockwise of end edge
+          inside = wide ? (cs >= 0 || ce >= 0) : (cs >= 0 && ce >= 0);
+        }
+      }
+
+      if (inside && !inRun) {
+        runStart = dx;
+        inRun = true;
+      } else if (!inside && inRun) {
+        canvas.drawFastHLine(cx + runStart, cy + dy, dx - runStart, color);
+        inRun = false;
+      }
+    }
+  }
+}
+
+// ==================== Row Masks ====================
+void packRowMask(TFT_eSPI& src, uint16_t* rows, int w, int h, uint16_t bg) {
+  for (int row = 0; row < h; row++) {
+    uint16_t bits = 0;
+    for (int col = 0; col < w && col < 16; col++) {
+      if (src.readPixel(col, row) != bg) {
+        bits |= 0x8000 >> col;
+      }
+    }
+    rows[row] = bits;
+  }
+}
+
+void drawRowMask(TFT_eSPI& canvas, int x, int y, const uint16_t* rows, int h, uint32_t color) {
+  for (int row = 0; row < h; row++) {
+    uint16_t bits = rows[row];
+    int col = 0;
+    while (bits != 0) {
+      // Skip clear pixels, then measure the run of set ones
+      while (!(bits & 0x8000)) {
+        bits <<= 1;
+        col++;
+      }
+      int start = col;
+      while (bits & 0x8000) {
+        bits <<= 1;
+        col++;
+      }
+      canvas.drawFastHLine(x + start, y + row, col - start, color);
+    }
+  }
+}
+
+// ==================== Bit Masks ====================
+void drawBitMask(TFT_eSPI& canvas, int x, int y, const uint8_t* bits, int stride,
+                 int w, int h, uint32_t color) {
+  int vpY = canvas.getViewportY();
+  int first = max(0, vpY - y);
+  int last = min(h, vpY + (int)canvas.getViewportHeight() - y);
+
+  for (int row = first; row < last; row++) {
+    const uint8_t* line = bits + row * stride;
+    int col = 0;
+    while (col < w) {
+      // Skip clear pixels (whole bytes at a time), then measure the run of set ones
+      if (line[col >> 3] == 0) {
+        col = (col | 7) + 1;
+        continue;
+      }
+      if (!(line[col >> 3] & (0x80 >> (col & 7)))) {
+        col++;
+        continue;
+      }
+      int start = col;
+      while (col < w && (line[col >> 3] & (0x80 >> (col & 7)))) {
+        col++;
+      }
+      canvas.drawFastHLine(x + start, y + row, col - start, color);
+    }
+  }
+}
@@ -0,0 +1,37 @@
+#ifndef SHAPES_H
+#define SHAPES_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// ==================== Filled Arcs ====================
+/**
+ * Fill a ring sector (or pie slice when innerR is 0) using integer maths and
+ * horizontal span fills. Works on the TFT or any sprite.
+ * @param cx, cy      - Centre
+ * @param outerR      - Outer radius (inclusive)
+ * @param innerR      - Inner radius; pixels within it are left untouched
+ * @param startAngle  - Degrees clockwise from 12 o'clock
+ * @param endAngle    - End angle; sweeps of 360 or more fill the full ring
+ */
+void fillArc(TFT_eSPI& canvas, int cx, int cy, int outerR, int innerR,
+             int startAngle, int endAngle, uint32_t color);
+
+// ==================== Row Masks ====================
+// Small 1-bit images up to 16 px wide: one uint16_t per row, bit 15 = leftmost pixel
+
+// Capture the pixels of src (w x h from 0,0) that differ from bg
+void packRowMask(TFT_eSPI& src, uint16_t* rows, int w, int h, uint16_t bg);
+
+// Draw the set bits of a row mask with its top-left at (x, y) as horizontal runs
+void drawRowMask(TFT_eSPI& canvas, int x, int y, const uint16_t* rows, int h, uint32_t color);
+
+// ==================== Bit Masks ====================
+// Packed 1-bit images of any width: stride bytes per row, MSB = leftmost pixel
+// (the layout of a 1-bit sprite's getPointer())
+
+// Draw the set bits as horizontal runs; rows outside the canvas viewport are skipped
+void drawBitMask(TFT_eSPI& canvas, int x, int y, const uint8_t* bits, int stride,
+                 int w, int h, uint32_t color);
+
+#endif
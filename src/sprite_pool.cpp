@@ -0,0 +1,236 @@
+#include "sprite_pool.h"
+#include "config.h"
+#include "screen.h"
+#include "seqlock.h"
+
+static const char* OWNER_NAMES[SPRITE_OWNER_COUNT] = {
+  "title", "clock", "status", "content", "scratch"
+};
+
+struct PoolSlot {
+  TFT_eSprite* sprite;  // Created on first use, kept for the device's lifetime
+  int16_t w;
+  int16_t h;
+  uint8_t depth;
+  uint32_t bytes;       // 0 = no buffer allocated
+  SpriteOwner owner;    // Current or last leaseholder
+  bool leased;
+  unsigned long lastUsed;
+};
+
+static PoolSlot slots[SPRITE_POOL_SLOTS];
+
+// Counters
+static uint32_t leaseCount = 0;
+static uint32_t warmHits = 0;
+static uint32_t failures = 0;
+static uint32_t evictions = 0;
+static uint32_t heldBytes = 0;       // Allocated, leased or warm
+static uint32_t leasedBytes = 0;
+static uint32_t highWaterBytes = 0;  // Peak heldBytes
+static uint32_t highWaterLeased = 0; // Peak leasedBytes
+
+// The pool as /sprites serves it. Only the render task leases sprites; it
+// publishes a copy from spritePoolTick() so the AsyncTCP task never reads a
+// slot mid-update.
+struct SlotReport {
+  uint32_t bytes;
+  int16_t w;
+  int16_t h;
+  uint8_t owner;
+  uint8_t depth;
+  uint8_t leased;
+  uint8_t reserved;
+};
+
+struct SpritePoolReport {
+  uint32_t leases;
+  uint32_t warmHits;
+  uint32_t failures;
+  uint32_t evictions;
+  uint32_t heldBytes;
+  uint32_t leasedBytes;
+  uint32_t highWaterBytes;
+  uint32_t highWaterLeased;
+  SlotReport slots[SPRITE_POOL_SLOTS];
+};
+
+static Seqlock<SpritePoolReport> report;
+
+// ==================== Helpers ====================
+static uint32_t spriteBytes(int16_t w, int16_t h, uint8_t depth) {
+  switch (depth) {
+    case 16: return (uint32_t)w * h * 2;
+    case 8:  return (uint32_t)w * h;
+    case 4:  return ((uint32_t)w * h + 1) / 2;
+    default: return (uint32_t)((w + 7) / 8) * h;
+  }
+}
+
+static void freeSlot(PoolSlot& s) {
+  s.sprite->deleteSprite();
+  heldBytes -= s.bytes;
+  s.bytes = 0;
+  evictions++;
+}
+
+// Free every warm sprite; returns true if anything was freed
+static bool freeWarmSlots() {
+  bool freed = false;
+  for (int i = 0; i < SPRITE_POOL_SLOTS; i++) {
+    if (!slots[i].leased && slots[i].bytes > 0) {
+      freeSlot(slots[i]);
+      freed = true;
+    }
+  }
+  return freed;
+}
+
+static TFT_eSprite* grant(PoolSlot& s, SpriteOwner owner) {
+  s.owner = owner;
+  s.leased = true;
+  s.lastUsed = millis();
+  leaseCount++;
+  leasedBytes += s.bytes;
+  if (leasedBytes > highWaterLeased) highWaterLeased = leasedBytes;
+  return s.sprite;
+}
+
+static void publishReport() {
+  SpritePoolReport r;
+  r.leases = leaseCount;
+  r.warmHits = warmHits;
+  r.failures = failures;
+  r.evictions = evictions;
+  r.heldBytes = heldBytes;
+  r.leasedBytes = leasedBytes;
+  r.highWaterBytes = highWaterBytes;
+  r.highWaterLeased = highWaterLeased;
+  for (int i = 0; i < SPRITE_POOL_SLOTS; i++) {
+    const PoolSlot& s = slots[i];
+    r.slots[i] = {s.bytes, s.w, s.h, (uint8_t)s.owner, s.depth, s.leased, 0};
+  }
+  report.publish(r);
+}
+
+// ==================== Lease / Release ====================
+TFT_eSprite* leaseSprite(SpriteOwner owner, int16_t w, int16_t h, uint8_t depth, bool* intact) {
+  if (intact) *intact = false;
+
+  // Warm sprite of the right shape, preferring the owner's own
+  PoolSlot* warm = nullptr;
+  for (int i = 0; i < SPRITE_POOL_SLOTS; i++) {
+    PoolSlot& s = slots[i];
+    if (s.leased || s.bytes == 0 || s.w != w || s.h != h || s.depth != depth) continue;
+    if (warm == nullptr || s.owner == owner) warm = &s;
+  }
+  if (warm != nullptr) {
+    if (intact) *intact = (warm->owner == owner);
+    warmHits++;
+    return grant(*warm, owner);
+  }
+
+  // Otherwise an empty slot, or the least recently used warm one
+  PoolSlot* slot = nullptr;
+  for (int i = 0; i < SPRITE_POOL_SLOTS; i++) {
+    PoolSlot& s = slots[i];
+    if (s.leased) continue;
+    if (s.bytes == 0) {
+      slot = &s;
+      break;
+    }
+    if (slot == nullptr || s.lastUsed < slot->lastUsed) slot = &s;
+  }
+  if (slot == nullptr) {
+    failures++;
+    return nullptr;
+  }
+  if (slot->sprite == nullptr) {
+    slot->sprite = new TFT_eSprite(&tft);
+  }
+  if (slot->bytes > 0) {
+    freeSlot(*slot);
+  }
+
+  slot->sprite->setColorDepth(depth);
+  if (slot->sprite->createSprite(w, h) == nullptr) {
+    // Give the heap back every warm buffer and try once more
+    if (!freeWarmSlots() || slot->sprite->createSprite(w, h) == nullptr) {
+      failures++;
+      return nullptr;
+    }
+  }
+
+  slot->w = w;
+  slot->h = h;
+  slot->depth = depth;
+  slot->bytes = spriteBytes(w, h, depth);
+  heldBytes += slot->bytes;
+  if (heldBytes > highWaterBytes) highWaterBytes = heldBytes;
+  return grant(*slot, owner);
+}
+
+void releaseSprite(TFT_eSprite* sprite) {
+  if (sprite == nullptr) {
+    return;
+  }
+  for (int i = 0; i < SPRITE_POOL_SLOTS; i++) {
+    PoolSlot& s = slots[i];
+    if (s.sprite == sprite && s.leased) {
+      s.leased = false;
+      s.lastUsed = millis();
+      leasedBytes -= s.bytes;
+      return;
+    }
+  }
+}
+
+// ==================== Idle Trim ====================
+void spritePoolTick() {
+  unsigned long now = millis();
+  for (int i = 0; i < SPRITE_POOL_SLOTS; i++) {
+    PoolSlot& s = slots[i];
+    // The content canvas is leased on every screen change and is the largest
+    // buffer: trimming it would only make the next switch reallocate and redraw
+    if (s.owner == SPRITE_OWNER_CONTENT) continue;
+    if (!s.leased && s.bytes > 0 && now - s.lastUsed >= SPRITE_POOL_IDLE_MS) {
+      freeSlot(s);
+    }
+  }
+  publishReport();
+}
+
+// ==================== Reporting ====================
+String spritePoolJson() {
+  SpritePoolReport r;
+  report.read(r);
+
+  String out = "{\"leases\":" + String(r.leases);
+  out += ",\"warm_hits\":" + String(r.warmHits);
+  out += ",\"failures\":" + String(r.failures);
+  out += ",\"evictions\":" + String(r.evictions);
+  out += ",\"held_bytes\":" + String(r.heldBytes);
+  out += ",\"leased_bytes\":" + String(r.leasedBytes);
+  out += ",\"high_water_bytes\":" + String(r.highWaterBytes);
+  out += ",\"high_water_leased_bytes\":" + String(r.highWaterLeased);
+  out += ",\"free_heap\":" + String(ESP.getFreeHeap());
+  out += ",\"slots\":[";
+  for (int i = 0; i < SPRITE_POOL_SLOTS; i++) {
+    const SlotReport& s = r.slots[i];
+    if (i > 0) out += ",";
+    if (s.bytes == 0) {
+      out += "null";
+      continue;
+    }
+    out += "{\"owner\":\"";
+    out += OWNER_NAMES[s.owner];
+    out += "\",\"w\":" + String(s.w);
+    out += ",\"h\":" + String(s.h);
+    out += ",\"depth\":" + String(s.depth);
+    out += ",\"bytes\":" + String(s.bytes);
+    out += ",\"leased\":" + String(s.leased ? "true" : "false");
+    out += "}";
+  }
+  out += "]}";
+  return out;
+}
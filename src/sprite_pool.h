@@ -0,0 +1,45 @@
+#ifndef SPRITE_POOL_H
+#define SPRITE_POOL_H
+
+#include <TFT_eSPI.h>
+
+// Who last drew into a pooled sprite (decides whether its pixels are still theirs)
+enum SpriteOwner {
+  SPRITE_OWNER_TITLE = 0,
+  SPRITE_OWNER_CLOCK,
+  SPRITE_OWNER_STATUS,
+  SPRITE_OWNER_CONTENT,  // 4-bit canvas for the three content zones
+  SPRITE_OWNER_SCRATCH,  // Short-lived 1-bit rasterisation buffers
+  SPRITE_OWNER_COUNT
+};
+
+/**
+ * Zones borrow their off-screen sprites for the length of a draw instead of
+ * keeping them allocated. A returned sprite stays allocated ("warm") so the
+ * next lease of the same size and depth skips the heap; warm sprites unused
+ * for SPRITE_POOL_IDLE_MS are freed by spritePoolTick(), except the content
+ * canvas, and all of them are freed when a new lease would not otherwise fit
+ * in the heap.
+ *
+ * Leased sprites keep whatever font, colours and viewport the last user set.
+ */
+
+/**
+ * Lease a w x h sprite at the given colour depth.
+ * @param intact - set true when the sprite still holds owner's last drawing
+ * @return the sprite, or nullptr if no slot or heap is available
+ */
+TFT_eSprite* leaseSprite(SpriteOwner owner, int16_t w, int16_t h, uint8_t depth,
+                         bool* intact = nullptr);
+
+// Return a leased sprite to the pool (nullptr is ignored)
+void releaseSprite(TFT_eSprite* sprite);
+
+// Free warm sprites that have been idle too long and publish the /sprites
+// report (render task, call in loop)
+void spritePoolTick();
+
+// Slots, bytes held and high-water mark, served by /sprites
+String spritePoolJson();
+
+#endif
@@ -2,7 +2,9 @@
 
 // ==================== Screen State ====================
 Screen currentScreen = DEFAULT_SCREEN;
-bool zoneDirty[ZONE_COUNT] = {true, true, true, true, true, true};
+
+// ==================== Damage Tracking ====================
+ZoneDamage zoneDamage[ZONE_COUNT];
 
 // ==================== Timing ====================
 unsigned long lastClockUpdate = 0;
@@ -10,10 +12,11 @@ unsigned long lastReminderRefresh = 0;
 
 // ==================== Notifications ====================
 Notification notifications[MAX_NOTIFICATIONS];
+int notifHead = 0;
 
 // ==================== Reminders ====================
 Reminder reminders[MAX_REMINDERS];
-int nextReminderId = 1;
+std::atomic<int> nextReminderId(1);
 
 // ==================== Now Playing ====================
 String nowPlayingSong = "";
@@ -36,30 +39,21 @@ bool albumArtValid = false;
 
 // ==================== PC Stats (Gaming Mode) ====================
 bool gamingMode = false;
-int pcCpuTemp = 0;
-int pcCpuUsage = 0;
-float pcCpuSpeed = 0.0;
-int pcRamUsed = 0;
-int pcRamTotal = 0;
-int pcGpuTemp = 0;
-int pcGpuUsage = 0;
-float pcNetDown = 0.0;
-float pcNetUp = 0.0;
-unsigned long pcStatsUpdated = 0;
 
 // ==================== Calendar View ====================
 int calViewMonth = -1;   // -1 = current month
 int calViewYear = 0;     // 0 = current year
+// (calViewYear << 4) | (calViewMonth + 1), so one load sees a matching pair
+static std::atomic<int> calViewShown(0);
 
 // ==================== Helper Functions ====================
 void initState() {
   currentScreen = DEFAULT_SCREEN;
-  for (int i = 0; i < ZONE_COUNT; i++) {
-    zoneDirty[i] = true;
-  }
+  setAllZonesDirty();
   for (int i = 0; i < MAX_NOTIFICATIONS; i++) {
     notifications[i] = Notification();
   }
+  notifHead = 0;
   for (int i = 0; i < MAX_REMINDERS; i++) {
     reminders[i] = Reminder();
   }
@@ -81,35 +75,159 @@ void initState() {
   // Reset calendar view to current month
   calViewMonth = -1;
   calViewYear = 0;
+  publishCalView();
+}
+
+void publishCalView() {
+  calViewShown.store((calViewYear << 4) | (calViewMonth + 1));
+}
+
+void readCalView(int* month, int* year) {
+  int packed = calViewShown.load();
+  *month = (packed & 0xF) - 1;
+  *year = packed >> 4;
+}
+
+bool getZoneBounds(Zone zone, int* x, int* y, int* w, int* h) {
+  int x_start, y_start, x_end, y_end;
+
+  switch (zone) {
+    case ZONE_TITLE:
+      x_start = ZONE_TITLE_X_START; x_end = ZONE_TITLE_X_END;
+      y_start = ZONE_TITLE_Y_START; y_end = ZONE_TITLE_Y_END;
+      break;
+    case ZONE_CLOCK:
+      x_start = ZONE_CLOCK_X_START; x_end = ZONE_CLOCK_X_END;
+      y_start = ZONE_CLOCK_Y_START; y_end = ZONE_CLOCK_Y_END;
+      break;
+    case ZONE_STATUS:
+      x_start = ZONE_STATUS_X_START; x_end = ZONE_STATUS_X_END;
+      y_start = ZONE_STATUS_Y_START; y_end = ZONE_STATUS_Y_END;
+      break;
+    case ZONE_CONTENT1:
+      x_start = ZONE_CONTENT1_X_START; x_end = ZONE_CONTENT1_X_END;
+      y_start = ZONE_CONTENT1_Y_START; y_end = ZONE_CONTENT1_Y_END;
+      break;
+    case ZONE_CONTENT2:
+      x_start = ZONE_CONTENT2_X_START; x_end = ZONE_CONTENT2_X_END;
+      y_start = ZONE_CONTENT2_Y_START; y_end = ZONE_CONTENT2_Y_END;
+      break;
+    case ZONE_CONTENT3:
+      x_start = ZONE_CONTENT3_X_START; x_end = ZONE_CONTENT3_X_END;
+      y_start = ZONE_CONTENT3_Y_START; y_end = ZONE_CONTENT3_Y_END;
+      break;
+    default:
+      return false;
+  }
+
+  *x = x_start;
+  *y = y_start;
+  *w = x_end - x_start + 1;
+  *h = y_end - y_start + 1;
+  return true;
+}
+
+// ==================== Damage Rects ====================
+static int32_t rectArea(const DamageRect& r) {
+  return (int32_t)r.w * r.h;
+}
+
+static DamageRect rectUnion(const DamageRect& a, const DamageRect& b) {
+  int x0 = min(a.x, b.x), y0 = min(a.y, b.y);
+  int x1 = max(a.x + a.w, b.x + b.w), y1 = max(a.y + a.h, b.y + b.h);
+  return {(int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+static bool rectsOverlap(const DamageRect& a, const DamageRect& b) {
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+void addDamageRect(DamageRect* list, uint8_t* count, uint8_t maxRects, DamageRect r) {
+  if (r.w <= 0 || r.h <= 0 || maxRects == 0) {
+    return;
+  }
+
+  for (;;) {
+    // Absorb any rect that overlaps r or sits flush against it
+    bool merged = false;
+    for (int i = 0; i < *count; i++) {
+      DamageRect u = rectUnion(list[i], r);
+      if (rectsOverlap(list[i], r) || rectArea(u) <= rectArea(list[i]) + rectArea(r)) {
+        r = u;
+        list[i] = list[--(*count)];
+        merged = true;
+        break;
+      }
+    }
+    if (merged) continue;
+
+    if (*count < maxRects) {
+      list[(*count)++] = r;
+      return;
+    }
+
+    // List full: fold r into the rect whose bounding box grows the least
+    int best = 0;
+    int32_t bestGrowth = INT32_MAX;
+    for (int i = 0; i < *count; i++) {
+      int32_t growth = rectArea(rectUnion(list[i], r)) - rectArea(list[i]);
+      if (growth < bestGrowth) {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    r = rectUnion(list[best], r);
+    list[best] = list[--(*count)];
+  }
+}
+
+void addZoneDamage(Zone zone, int x, int y, int w, int h) {
+  int zx, zy, zw, zh;
+  if (!getZoneBounds(zone, &zx, &zy, &zw, &zh)) {
+    return;
+  }
+
+  // Clip to the zone
+  int x0 = max(x, zx), y0 = max(y, zy);
+  int x1 = min(x + w, zx + zw), y1 = min(y + h, zy + zh);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  DamageRect r = {(int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+  addDamageRect(zoneDamage[zone].rects, &zoneDamage[zone].count, MAX_DAMAGE_RECTS, r);
 }
 
 void setZoneDirty(Zone zone) {
-  if (zone >= 0 && zone < ZONE_COUNT) {
-    zoneDirty[zone] = true;
+  int x, y, w, h;
+  if (getZoneBounds(zone, &x, &y, &w, &h)) {
+    // Whole zone supersedes any partial damage
+    zoneDamage[zone].rects[0] = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+    zoneDamage[zone].count = 1;
   }
 }
 
 void setAllZonesDirty() {
   for (int i = 0; i < ZONE_COUNT; i++) {
-    zoneDirty[i] = true;
+    setZoneDirty((Zone)i);
   }
 }
 
 void setAllContentDirty() {
-  zoneDirty[ZONE_CONTENT1] = true;
-  zoneDirty[ZONE_CONTENT2] = true;
-  zoneDirty[ZONE_CONTENT3] = true;
+  setZoneDirty(ZONE_CONTENT1);
+  setZoneDirty(ZONE_CONTENT2);
+  setZoneDirty(ZONE_CONTENT3);
 }
 
 void clearZoneDirty(Zone zone) {
   if (zone >= 0 && zone < ZONE_COUNT) {
-    zoneDirty[zone] = false;
+    zoneDamage[zone].count = 0;
   }
 }
 
 bool isZoneDirty(Zone zone) {
   if (zone >= 0 && zone < ZONE_COUNT) {
-    return zoneDirty[zone];
+    return zoneDamage[zone].count > 0;
   }
   return false;
 }
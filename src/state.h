@@ -2,21 +2,42 @@
 #define STATE_H
 
 #include "types.h"
+#include <atomic>
 
 // ==================== Screen State ====================
 extern Screen currentScreen;
-extern bool zoneDirty[ZONE_COUNT];
+
+// ==================== Damage Tracking ====================
+/**
+ * Screen-space rectangle that needs repainting. Each zone keeps up to
+ * MAX_DAMAGE_RECTS of them; overlapping rects, and rects whose bounding box
+ * costs no extra pixels, are merged as they are added.
+ */
+struct DamageRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+struct ZoneDamage {
+  DamageRect rects[MAX_DAMAGE_RECTS];
+  uint8_t count;
+};
+
+extern ZoneDamage zoneDamage[ZONE_COUNT];
 
 // ==================== Timing ====================
 extern unsigned long lastClockUpdate;
 extern unsigned long lastReminderRefresh;
 
 // ==================== Notifications ====================
-extern Notification notifications[MAX_NOTIFICATIONS];
+extern Notification notifications[MAX_NOTIFICATIONS];  // Ring; see notificationAt()
+extern int notifHead;                                  // Index of the newest
 
 // ==================== Reminders ====================
 extern Reminder reminders[MAX_REMINDERS];
-extern int nextReminderId;
+extern std::atomic<int> nextReminderId;  // Claimed by API handlers (reminder_snapshot.h)
 
 // ==================== Now Playing ====================
 extern String nowPlayingSong;
@@ -40,28 +61,27 @@ extern int albumArtHeight;          // Actual height of current art (always 18)
 extern bool albumArtValid;          // True when buffer has valid art
 
 // ==================== PC Stats (Gaming Mode) ====================
-extern bool gamingMode;                // Is gaming mode active?
-extern int pcCpuTemp;                  // CPU temperature in °C
-extern int pcCpuUsage;                 // CPU usage percentage
-extern float pcCpuSpeed;               // CPU speed in GHz
-extern int pcRamUsed;                  // RAM used in GB
-extern int pcRamTotal;                 // RAM total in GB
-extern int pcGpuTemp;                  // GPU temperature in °C
-extern int pcGpuUsage;                 // GPU usage percentage
-extern float pcNetDown;                // Download speed in Mbps
-extern float pcNetUp;                  // Upload speed in Mbps
-extern unsigned long pcStatsUpdated;   // Last update timestamp
+extern bool gamingMode;                // Is gaming mode active? (samples: pc_stats.h)
 
 // ==================== Calendar View ====================
 extern int calViewMonth;               // Month to display (0-11), -1 = current
 extern int calViewYear;                // Year to display, 0 = current
 
+// Copy of the two above for API handlers; the render task publishes after changing them
+void publishCalView();
+void readCalView(int* month, int* year);  // Any task
+
 // ==================== Helper Functions ====================
 void initState();
-void setZoneDirty(Zone zone);
+bool getZoneBounds(Zone zone, int* x, int* y, int* w, int* h);
+void setZoneDirty(Zone zone);  // Damage the whole zone
 void setAllZonesDirty();
 void setAllContentDirty();  // Helper to mark all 3 content zones dirty
+void addZoneDamage(Zone zone, int x, int y, int w, int h);  // Damage part of a zone (clipped to it)
 void clearZoneDirty(Zone zone);
 bool isZoneDirty(Zone zone);
 
+// Add r to list[0..count), merging as above; merges the cheapest pair when full
+void addDamageRect(DamageRect* list, uint8_t* count, uint8_t maxRects, DamageRect r);
+
 #endif
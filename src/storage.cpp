@@ -43,7 +43,7 @@ void saveReminders() {
 
   // Save as bytes
   prefs.putBytes("data", storage, sizeof(storage));
-  prefs.putInt("nextId", nextReminderId);
+  prefs.putInt("nextId", nextReminderId.load());
 
   Serial.println("Reminders saved to flash");
 }
@@ -84,7 +84,7 @@ void loadReminders() {
     if (reminders[i].id != 0) loadedCount++;
   }
 
-  Serial.printf("Loaded %d reminders from flash, nextId=%d\n", loadedCount, nextReminderId);
+  Serial.printf("Loaded %d reminders from flash, nextId=%d\n", loadedCount, nextReminderId.load());
 }
 
 void clearStoredReminders() {
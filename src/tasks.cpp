@@ -0,0 +1,322 @@
+#include "tasks.h"
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#ifndef NATIVE_BUILD
+#include <freertos/task.h>
+#endif
+#include "config.h"
+#include "state.h"
+#include "screen.h"
+#include "frame_scheduler.h"
+#include "render_metrics.h"
+#include "sprite_pool.h"
+#include "reminder_screen.h"
+#include "notif_screen.h"
+#include "led_control.h"
+#include "button_control.h"
+#include "encoder_control.h"
+#include "network.h"
+#include "power.h"
+#include "pc_stats.h"
+#include "heap_stats.h"
+
+// ==================== Events ====================
+// Messages to the render task, which owns the screen state
+enum TaskEvent : uint8_t {
+  EVT_CLEAR_BUTTON,
+  EVT_CLEAR_BUTTON_HOLD,
+  EVT_ENCODER_CW,
+  EVT_ENCODER_CCW,
+  EVT_ENCODER_PRESS,
+  EVT_CHECK_REMINDERS,
+  EVT_REFRESH_COUNTDOWNS
+};
+
+static QueueHandle_t events = nullptr;
+static std::atomic<uint32_t> eventsPosted(0);  // Posted from two tasks
+static std::atomic<uint32_t> eventsDropped(0);
+
+// Input wakes the render task at once; scheduler events ride along with
+// the next clock tick, which is at most a second away
+static void postEvent(TaskEvent ev, bool wake) {
+  if (xQueueSend(events, &ev, 0) == pdPASS) {
+    eventsPosted++;
+    if (wake) wakeRenderTask();
+  } else {
+    eventsDropped++;
+  }
+}
+
+static void applyEvent(TaskEvent ev) {
+  switch (ev) {
+    case EVT_CLEAR_BUTTON:
+      noteActivity();
+      clearButtonPressed();
+      break;
+    case EVT_CLEAR_BUTTON_HOLD:
+      noteActivity();
+      clearButtonHeld();
+      break;
+    case EVT_ENCODER_CW:
+      noteActivity();
+      encoderTurned(1);
+      break;
+    case EVT_ENCODER_CCW:
+      noteActivity();
+      encoderTurned(-1);
+      break;
+    case EVT_ENCODER_PRESS:
+      noteActivity();
+      encoderPressed();
+      break;
+    case EVT_CHECK_REMINDERS:
+      checkReminders();
+      break;
+    case EVT_REFRESH_COUNTDOWNS:
+      // Refresh reminder screen periodically (for countdown updates)
+      if (currentScreen == SCREEN_REMINDER) {
+        refreshReminderCountdowns();
+      }
+      break;
+  }
+}
+
+// A new PC stats sample (published by the /pcstats handler) redraws the status bar
+static void checkPcStats() {
+  static uint32_t seenSequence = 0;
+  uint32_t seq = pcStatsSequence();
+  if ((seq & 1) == 0 && seq != seenSequence) {
+    seenSequence = seq;
+    noteActivity();
+    setZoneDirty(ZONE_STATUS);
+  }
+}
+
+// ==================== Task Steps ====================
+static void renderStep() {
+  TaskEvent ev;
+  while (xQueueReceive(events, &ev, 0) == pdTRUE) {
+    applyEvent(ev);
+  }
+  checkPcStats();
+  notifHistoryTick();
+  ledTick();
+
+  // Enter or leave static idle before the ticker decides whether to animate
+  powerTick();
+
+  // Advance the now playing ticker / disc animation (marks the status zone dirty)
+  updateNowPlayingTicker();
+
+  // Apply API commands and draw dirty zones when a frame is due
+  runFrameScheduler();
+
+  // Roll render metrics window (prints to serial if enabled)
+  metricsTick();
+
+  // Free pooled sprites that zones have stopped using
+  spritePoolTick();
+}
+
+// Sleep until the next frame, ticker or LED blink step (an event or command wakes it sooner)
+static uint32_t renderWaitMs() {
+  return min(min(frameSchedulerWaitMs(), nowPlayingTickerWaitMs()), ledWaitMs());
+}
+
+static void inputStep() {
+  ButtonPress press = pollClearButton();
+  if (press != BUTTON_NONE) {
+    postEvent(press == BUTTON_LONG ? EVT_CLEAR_BUTTON_HOLD : EVT_CLEAR_BUTTON, true);
+  }
+  int turn = pollEncoderTurn();
+  if (turn != 0) {
+    postEvent(turn > 0 ? EVT_ENCODER_CW : EVT_ENCODER_CCW, true);
+  }
+  if (pollEncoderButton()) {
+    postEvent(EVT_ENCODER_PRESS, true);
+  }
+}
+
+static uint32_t inputWaitMs() {
+  return staticIdleActive() ? STATIC_IDLE_INPUT_PERIOD_MS : INPUT_TASK_PERIOD_MS;
+}
+
+static void schedulerStep() {
+  static unsigned long lastCountdownRefresh = 0;
+
+  postEvent(EVT_CHECK_REMINDERS, false);
+  if (millis() - lastCountdownRefresh > REMINDER_REFRESH_INTERVAL) {
+    postEvent(EVT_REFRESH_COUNTDOWNS, false);
+    lastCountdownRefresh = millis();
+  }
+}
+
+static void networkStep() {
+  checkWiFiReconnect();
+  heapStatsTick();
+}
+
+// ==================== Tasks ====================
+struct AppTask {
+  const char* name;
+  uint8_t core;
+  uint8_t priority;     // FreeRTOS priority; the Arduino loop task ran at 1
+  uint16_t stackBytes;
+  uint16_t periodMs;     // With waitMs: the longest wait
+  void (*step)();
+  uint32_t (*waitMs)();  // Wait after each step, or nullptr for a fixed period
+};
+
+// Host order: as listed, so input reaches the render step of the same loop()
+static const AppTask APP_TASKS[] = {
+  {"input",     1, 3, 3072, INPUT_TASK_PERIOD_MS,     inputStep,     inputWaitMs},
+  {"scheduler", 0, 1, 3072, SCHEDULER_TASK_PERIOD_MS, schedulerStep, nullptr},
+  {"render",    1, 2, 8192, RENDER_TASK_PERIOD_MS,    renderStep,    renderWaitMs},
+  {"network",   0, 1, 4096, NETWORK_TASK_PERIOD_MS,   networkStep,   nullptr},
+};
+static const int APP_TASK_COUNT = sizeof(APP_TASKS) / sizeof(APP_TASKS[0]);
+
+struct AppTaskState {
+#ifndef NATIVE_BUILD
+  TaskHandle_t handle;
+#else
+  unsigned long nextRun;
+#endif
+  // Written by the task itself, read by the HTTP handlers
+  std::atomic<uint32_t> runs;
+  std::atomic<uint32_t> busyUs;  // Step time (wraps), including time preempted by other tasks
+  std::atomic<uint32_t> maxUs;
+};
+
+static AppTaskState appTaskState[APP_TASK_COUNT];
+static std::atomic<int> renderTask(-1);  // Index in APP_TASKS once started, for wakeRenderTask()
+
+// tasksJson()'s window baselines, touched only by the AsyncTCP task
+static uint32_t reportedBusyUs[APP_TASK_COUNT];
+static unsigned long lastReportMs = 0;
+static uint32_t nextWaitMs(int t) {
+  const AppTask& task = APP_TASKS[t];
+  return task.waitMs ? min(task.waitMs(), (uint32_t)task.periodMs) : task.periodMs;
+}
+
+static void runStep(int t) {
+  AppTaskState& s = appTaskState[t];
+  unsigned long start = micros();
+  APP_TASKS[t].step();
+  uint32_t us = micros() - start;
+  // Single writer: plain load and store, no read-modify-write needed
+  s.runs.store(s.runs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  s.busyUs.store(s.busyUs.load(std::memory_order_relaxed) + us, std::memory_order_relaxed);
+  if (us > s.maxUs.load(std::memory_order_relaxed)) s.maxUs.store(us, std::memory_order_relaxed);
+}
+
+#ifndef NATIVE_BUILD
+static void taskMain(void* arg) {
+  int t = (int)(intptr_t)arg;
+  TickType_t wake = xTaskGetTickCount();
+  for (;;) {
+    runStep(t);
+    if (APP_TASKS[t].waitMs) {
+      // Sleep until the deadline, or until wakeRenderTask() notifies us
+      ulTaskNotifyTake(pdTRUE, max((TickType_t)1, pdMS_TO_TICKS(nextWaitMs(t))));
+    } else {
+      vTaskDelayUntil(&wake, pdMS_TO_TICKS(APP_TASKS[t].periodMs));
+    }
+  }
+}
+#endif
+
+void startTasks() {
+  events = xQueueCreate(TASK_EVENT_QUEUE_DEPTH, sizeof(TaskEvent));
+  lastReportMs = millis();
+
+#ifndef NATIVE_BUILD
+  for (int t = 0; t < APP_TASK_COUNT; t++) {
+    const AppTask& task = APP_TASKS[t];
+    if (xTaskCreatePinnedToCore(taskMain, task.name, task.stackBytes, (void*)(intptr_t)t,
+                                task.priority, &appTaskState[t].handle, task.core) != pdPASS) {
+      Serial.printf("Tasks: failed to start %s\n", task.name);
+    }
+  }
+#endif
+
+  for (int t = 0; t < APP_TASK_COUNT; t++) {
+    if (APP_TASKS[t].step == renderStep) renderTask = t;
+  }
+}
+
+void runTasksFromLoop() {
+#ifndef NATIVE_BUILD
+  vTaskDelete(nullptr);
+#else
+  unsigned long now = millis();
+  for (int t = 0; t < APP_TASK_COUNT; t++) {
+    AppTaskState& s = appTaskState[t];
+    if ((long)(now - s.nextRun) >= 0) {
+      runStep(t);
+      s.nextRun = now + nextWaitMs(t);
+    }
+  }
+#endif
+}
+
+void wakeRenderTask() {
+  int t = renderTask;
+  if (t < 0) {
+    return;  // Not started yet; the first run drains whatever is queued
+  }
+#ifndef NATIVE_BUILD
+  if (appTaskState[t].handle != nullptr) {
+    xTaskNotifyGive(appTaskState[t].handle);
+  }
+#else
+  appTaskState[t].nextRun = millis();
+#endif
+}
+
+uint32_t taskBusyUsOnCore(int core) {
+  uint32_t busy = 0;
+  for (int t = 0; t < APP_TASK_COUNT; t++) {
+    if (APP_TASKS[t].core == core) busy += appTaskState[t].busyUs.load(std::memory_order_relaxed);
+  }
+  return busy;
+}
+
+// ==================== Reporting ====================
+String tasksJson() {
+  // CPU use is over the window since the previous call
+  unsigned long now = millis();
+  uint32_t windowMs = max(1UL, now - lastReportMs);
+  lastReportMs = now;
+
+  String out = "{\"window_ms\":" + String(windowMs);
+  out += ",\"events_queued\":" + String((uint32_t)uxQueueMessagesWaiting(events));
+  out += ",\"events_posted\":" + String(eventsPosted.load());
+  out += ",\"events_dropped\":" + String(eventsDropped.load());
+  out += ",\"tasks\":[";
+  for (int t = 0; t < APP_TASK_COUNT; t++) {
+    const AppTask& task = APP_TASKS[t];
+    const AppTaskState& s = appTaskState[t];
+    uint32_t busy = s.busyUs.load(std::memory_order_relaxed);
+    float cpuPct = (uint32_t)(busy - reportedBusyUs[t]) / (windowMs * 10.0f);
+    reportedBusyUs[t] = busy;
+
+    if (t > 0) out += ",";
+    out += "{\"task\":\"";
+    out += task.name;
+    out += "\",\"core\":" + String(task.core);
+    out += ",\"priority\":" + String(task.priority);
+    out += ",\"period_ms\":" + String(task.periodMs);
+    out += ",\"runs\":" + String(s.runs.load(std::memory_order_relaxed));
+    out += ",\"cpu_pct\":" + String(cpuPct, 1);
+    out += ",\"max_us\":" + String(s.maxUs.load(std::memory_order_relaxed));
+#ifndef NATIVE_BUILD
+    out += ",\"stack_bytes\":" + String(task.stackBytes);
+    out += ",\"stack_free\":" + String((uint32_t)uxTaskGetStackHighWaterMark(s.handle));
+#endif
+    out += "}";
+  }
+  out += "]}";
+  return out;
+}
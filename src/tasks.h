@@ -0,0 +1,40 @@
+#ifndef TASKS_H
+#define TASKS_H
+
+#include <Arduino.h>
+
+/**
+ * The firmware's FreeRTOS tasks, each a step function run every period (the
+ * render task instead sleeps until its next frame or animation step):
+ *
+ *   render    core 1  drains the API command queue and task events, runs the
+ *                     frame scheduler, ticker, metrics and sprite pool
+ *   input     core 1  polls the clear button (press and hold) and the encoder
+ *   scheduler core 0  decides when reminders are checked and countdowns redrawn
+ *   network   core 0  WiFi reconnect, which can block for a while
+ *
+ * The render task owns all screen state. The others never change it; they post
+ * events that the render task applies before its next frame.
+ *
+ * Each step's run time is accumulated, so /tasks can report CPU use per task,
+ * along with each task's stack high-water mark. On the host there are no
+ * threads: loop() runs each task's step when its period is due.
+ */
+
+// Create the event queue and start the tasks (end of setup())
+void startTasks();
+
+// Called by loop(): on the board this ends the Arduino loop task, whose work
+// the tasks now do; on the host it runs every task step that is due
+void runTasksFromLoop();
+
+// Run the render task now instead of at its next deadline (any task)
+void wakeRenderTask();
+
+// Step time of the tasks pinned to a core, in us (wraps); see power.h
+uint32_t taskBusyUsOnCore(int core);
+
+// Per-task runs, CPU use since the last call, max step time and free stack
+String tasksJson();
+
+#endif
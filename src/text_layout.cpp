@@ -0,0 +1,170 @@
+#include "text_layout.h"
+
+static const char ELLIPSIS[] = "...";
+
+// ==================== Glyph Metrics ====================
+static inline bool inFont(const FontMetrics& m, uint8_t c) {
+  return c >= m.first && c <= m.last;
+}
+
+static inline int advanceOf(const FontMetrics& m, uint8_t c) {
+  return inFont(m, c) ? pgm_read_byte(&m.advance[c - m.first]) : 0;
+}
+
+// Contribution of c as the last glyph of a string (digits included: TFT_eSPI
+// only keeps their xAdvance for drawNumber()/drawFloat(), which we never use)
+static inline int lastGlyphWidth(const FontMetrics& m, uint8_t c) {
+  if (!inFont(m, c)) return 0;
+  return (int8_t)pgm_read_byte(&m.ink[c - m.first]);
+}
+
+static int advanceSum(const FontMetrics& m, const char* text, int len) {
+  int width = 0;
+  for (int i = 0; i < len; i++) {
+    width += advanceOf(m, (uint8_t)text[i]);
+  }
+  return width;
+}
+
+int textWidthPx(FontId font, const char* text, int len) {
+  const FontMetrics& m = FONT_METRICS[font];
+  if (len < 0) {
+    len = strlen(text);
+  }
+  if (len == 0) {
+    return 0;
+  }
+  return advanceSum(m, text, len - 1) + lastGlyphWidth(m, (uint8_t)text[len - 1]);
+}
+
+int textAdvancePx(FontId font, const char* text, int len) {
+  return advanceSum(FONT_METRICS[font], text, len);
+}
+
+// ==================== Wrapping ====================
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t';
+}
+
+// Trim spaces off both ends of [start, end) and fill line
+static void setLine(FontId font, const char* text, int start, int end, bool ellipsis,
+                    TextLine* line) {
+  while (start < end && isSpace(text[start])) start++;
+  while (end > start && isSpace(text[end - 1])) end--;
+  line->start = start;
+  line->len = end - start;
+  line->ellipsis = ellipsis;
+  if (ellipsis) {
+    // "..." follows, so every glyph of the text counts with its advance
+    line->width = advanceSum(FONT_METRICS[font], text + start, end - start) +
+                  textWidthPx(font, ELLIPSIS);
+  } else {
+    line->width = textWidthPx(font, text + start, end - start);
+  }
+}
+
+int layoutWrap(FontId font, const char* text, int maxWidth, TextLine* lines, int maxLines) {
+  const FontMetrics& m = FONT_METRICS[font];
+  int textLen = strlen(text);
+  int ellipsisW = textWidthPx(font, ELLIPSIS);
+  int pos = 0;
+  int count = 0;
+
+  while (count < maxLines) {
+    while (pos < textLen && isSpace(text[pos])) pos++;
+    if (pos >= textLen) {
+      break;
+    }
+
+    // Longest run from pos that fits, remembering the last space to break at
+    int advance = 0;  // Sum of advances of [pos, end)
+    int end = pos;
+    int lastSpace = -1;
+    bool newline = false;
+    while (end < textLen) {
+      uint8_t c = (uint8_t)text[end];
+      if (c == '\n') {
+        newline = true;
+        break;
+      }
+      if (advance + lastGlyphWidth(m, c) > maxWidth) {
+        break;
+      }
+      if (isSpace(c)) {
+        lastSpace = end;
+      }
+      advance += advanceOf(m, c);
+      end++;
+    }
+
+    bool rest = newline || end < textLen;
+    if (!rest) {
+      setLine(font, text, pos, end, false, &lines[count++]);
+      break;
+    }
+
+    if (count == maxLines - 1) {
+      // Last line: drop characters until the text plus "..." fits...
+      int cut = end;
+      while (cut > pos && advance + ellipsisW > maxWidth) {
+        cut--;
+        advance -= advanceOf(m, (uint8_t)text[cut]);
+      }
+      // ...then end on a word boundary if the line has one
+      if (!newline || cut < end) {
+        for (int i = cut; i > pos; i--) {
+          if (isSpace(text[i])) {
+            cut = i;
+            break;
+          }
+        }
+      }
+      setLine(font, text, pos, cut, true, &lines[count++]);
+      break;
+    }
+
+    if (newline) {
+      setLine(font, text, pos, end, false, &lines[count++]);
+      pos = end + 1;
+    } else if (lastSpace > pos) {
+      setLine(font, text, pos, lastSpace, false, &lines[count++]);
+      pos = lastSpace + 1;
+    } else {
+      // A single word wider than the line: break it where it overflows
+      if (end == pos) end++;
+      setLine(font, text, pos, end, false, &lines[count++]);
+      pos = end;
+    }
+  }
+
+  return count;
+}
+
+int layoutFit(FontId font, const char* text, int maxWidth, TextLine* line) {
+  return layoutWrap(font, text, maxWidth, line, 1);
+}
+
+// ==================== Output ====================
+int layoutCopyLine(const char* text, const TextLine& line, char* out, size_t outLen) {
+  if (outLen == 0) {
+    return 0;
+  }
+  size_t extra = line.ellipsis ? sizeof(ELLIPSIS) - 1 : 0;
+  size_t n = line.len;
+  if (n + extra + 1 > outLen) {
+    n = outLen > extra + 1 ? outLen - extra - 1 : 0;
+  }
+  memcpy(out, text + line.start, n);
+  if (line.ellipsis && n + extra + 1 <= outLen) {
+    memcpy(out + n, ELLIPSIS, extra);
+    n += extra;
+  }
+  out[n] = '\0';
+  return n;
+}
+
+int drawTextLine(TFT_eSPI& canvas, const char* text, const TextLine& line, int x, int y) {
+  char buf[LAYOUT_MAX_LINE_CHARS + 1];
+  layoutCopyLine(text, line, buf, sizeof(buf));
+  return canvas.drawString(buf, x, y);
+}
@@ -0,0 +1,50 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "fonts/font_metrics.h"
+
+/**
+ * Pixel-accurate measuring, word-wrap and ellipsis for the GFX fonts, using
+ * the advance tables in fonts/font_metrics.h. Nothing here allocates: lines
+ * are returned as spans of the source text.
+ *
+ * Widths follow TFT_eSPI::textWidth() for drawString(): every glyph
+ * contributes its xAdvance except the last, which contributes its inked
+ * extent (xOffset + width), whatever the character.
+ */
+
+static const int LAYOUT_MAX_LINE_CHARS = 63;  // Longest line drawTextLine() can copy
+
+struct TextLine {
+  uint16_t start;  // Offset of the first character in the source text
+  uint16_t len;    // Characters taken from the source (edge spaces trimmed)
+  int16_t width;   // Pixel width as drawn, including the ellipsis
+  bool ellipsis;   // Text was cut here; "..." follows
+};
+
+// Width of the first len characters of text (len < 0: whole string)
+int textWidthPx(FontId font, const char* text, int len = -1);
+
+// Pen position after the first len characters: where the next glyph would start
+int textAdvancePx(FontId font, const char* text, int len);
+
+/**
+ * Word-wrap text into at most maxLines lines no wider than maxWidth. Lines
+ * break at spaces (or mid-word when a word alone is too wide) and at '\n'.
+ * If the text doesn't fit, the last line is cut to leave room for "...".
+ * @return number of lines written (0 for empty text)
+ */
+int layoutWrap(FontId font, const char* text, int maxWidth, TextLine* lines, int maxLines);
+
+// Single-line form of layoutWrap (returns 0 or 1)
+int layoutFit(FontId font, const char* text, int maxWidth, TextLine* line);
+
+// Copy a line (plus "..." if cut) into out; returns the string length
+int layoutCopyLine(const char* text, const TextLine& line, char* out, size_t outLen);
+
+// Draw a line with canvas's current font (which must match the layout font); returns its width
+int drawTextLine(TFT_eSPI& canvas, const char* text, const TextLine& line, int x, int y);
+
+#endif
@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include "config.h"
+#include "icons/icons.h"
 
 // ==================== Screen Zones ====================
 enum Zone {
@@ -24,13 +25,21 @@ enum Screen {
 };
 
 // ==================== Notification ====================
+// Fixed size with inline text, so storing one never touches the heap
 struct Notification {
-  String app;
-  String from;
-  String message;
+  uint32_t id;  // Assigned by addNotification; 0 = empty slot
+  uint8_t icon;  // lookupAppIcon(app), resolved when stored
+  uint32_t iconKey;  // Uploaded icon (icon_cache.h) when icon is APP_ICON_NONE, else 0
   uint16_t color;
-
-  Notification() : app(""), from(""), message(""), color(TFT_WHITE) {}
+  uint16_t count;     // Arrivals merged into this entry (1 = just this one)
+  uint32_t updated;   // millis() of the latest arrival, for coalescing
+  char app[NOTIF_APP_MAX_CHARS + 1];
+  char from[NOTIF_SENDER_MAX_CHARS + 1];
+  char message[NOTIF_MSG_MAX_CHARS + 1];
+
+  Notification() : id(0), icon(APP_ICON_NONE), iconKey(0), color(TFT_WHITE), count(0), updated(0) {
+    app[0] = from[0] = message[0] = '\0';
+  }
 };
 
 // ==================== Reminder ====================
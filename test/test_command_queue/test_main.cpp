@@ -0,0 +1,167 @@
+/**
+ * Command queue under two threads, as on the device: one pushes like the
+ * AsyncTCP task, the other pops like the render task.
+ *
+ *   pio test -e native -f test_command_queue
+ */
+
+#include <unity.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "command_queue.h"
+#include "icon_cache.h"
+#include "reminder_snapshot.h"
+
+static const uint32_t STRESS_COMMANDS = 200000;
+static const uint32_t BLOB_EVERY = 64;         // Every Nth command carries the blob
+static const uint32_t CONSUMER_PAUSE_EVERY = 4096;  // Pops between stalls, so the ring fills
+
+// Counter from commandQueueJson()
+static long queueCounter(const char* key) {
+  String json = commandQueueJson();
+  String tag = String("\"") + key + "\":";
+  int at = json.indexOf(tag);
+  TEST_ASSERT_TRUE(at >= 0);
+  return json.substring(at + tag.length()).toInt();
+}
+
+static uint32_t commandSeq(const Command& cmd) {
+  return cmd.type == CMD_STORE_ICON ? (uint32_t)strtoul(cmd.icon.app, nullptr, 10) : (uint32_t)cmd.motorSpeed;
+}
+
+void setUp() {
+  Command cmd;
+  while (popCommand(cmd)) {
+  }
+}
+
+void tearDown() {}
+
+void test_pushes_arrive_in_order_and_blob_is_released() {
+  uint8_t* blob = acquireCommandBlob();  // Same buffer every time; the consumer checks it
+  TEST_ASSERT_NOT_NULL(blob);
+  releaseCommandBlob();
+
+  long droppedBefore = queueCounter("dropped");
+  long pushedBefore = queueCounter("pushed");
+
+  std::atomic<bool> go(false), producerDone(false);
+  uint32_t rejected = 0;
+  uint32_t received = 0, blobsReceived = 0, outOfOrder = 0, badBlobs = 0;
+
+  std::thread producer([&] {
+    while (!go.load()) {
+    }
+    for (uint32_t seq = 1; seq <= STRESS_COMMANDS; seq++) {
+      Command cmd;
+      cmd.type = CMD_MOTOR;
+      cmd.motorSpeed = (int)seq;
+      bool withBlob = false;
+      if (seq % BLOB_EVERY == 0) {
+        uint8_t* b = acquireCommandBlob();
+        if (b) {  // Else still held by an unapplied command: send it without
+          memset(b, seq & 0xFF, ICON_CACHE_BYTES);
+          cmd.type = CMD_STORE_ICON;
+          snprintf(cmd.icon.app, sizeof(cmd.icon.app), "%u", (unsigned)seq);
+          withBlob = true;
+        }
+      }
+      if (!pushCommand(cmd)) {
+        rejected++;
+        if (withBlob) releaseCommandBlob();  // As a handler does when the queue is full
+        std::this_thread::yield();  // A 503'd client backs off before retrying
+      }
+    }
+    producerDone = true;
+  });
+
+  std::thread consumer([&] {
+    uint32_t last = 0;
+    Command cmd;
+    while (!go.load()) {
+    }
+    for (;;) {
+      if (!popCommand(cmd)) {
+        if (producerDone.load()) {
+          if (!popCommand(cmd)) break;  // Pushes before done are visible now
+        } else {
+          std::this_thread::yield();
+          continue;
+        }
+      }
+      uint32_t seq = commandSeq(cmd);
+      if (seq <= last) outOfOrder++;
+      last = seq;
+      received++;
+      if (cmd.type == CMD_STORE_ICON) {
+        for (int i = 0; i < ICON_CACHE_BYTES; i++) {
+          if (blob[i] != (seq & 0xFF)) {
+            badBlobs++;
+            break;
+          }
+        }
+        blobsReceived++;
+        releaseCommandBlob();
+      }
+      if (received % CONSUMER_PAUSE_EVERY == 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+      }
+    }
+  });
+
+  go = true;
+  producer.join();
+  consumer.join();
+
+  TEST_ASSERT_EQUAL_UINT32(0, outOfOrder);
+  TEST_ASSERT_EQUAL_UINT32(0, badBlobs);
+  TEST_ASSERT_EQUAL_UINT32(STRESS_COMMANDS, received + rejected);
+  TEST_ASSERT_TRUE(rejected > 0);  // The stalls did fill the ring
+  TEST_ASSERT_TRUE(blobsReceived > 0);
+  TEST_ASSERT_EQUAL_INT32((long)rejected, queueCounter("dropped") - droppedBefore);
+  TEST_ASSERT_EQUAL_INT32((long)received, queueCounter("pushed") - pushedBefore);
+  TEST_ASSERT_EQUAL_INT32(0, queueCounter("queued"));
+
+  // Every blob taken was given back
+  uint8_t* again = acquireCommandBlob();
+  TEST_ASSERT_NOT_NULL(again);
+  releaseCommandBlob();
+}
+
+void test_reminder_slots_are_claimed_once() {
+  initReminderSnapshot();
+  int freeAtStart = reminderSlotsFree();
+  std::vector<int> idsA, idsB;
+
+  auto claimAll = [](std::vector<int>* ids) {
+    while (reserveReminderSlot()) {
+      ids->push_back(reserveReminderId());
+    }
+  };
+  std::thread a(claimAll, &idsA);
+  std::thread b(claimAll, &idsB);
+  a.join();
+  b.join();
+
+  std::vector<int> ids(idsA);
+  ids.insert(ids.end(), idsB.begin(), idsB.end());
+  std::sort(ids.begin(), ids.end());
+  TEST_ASSERT_EQUAL_INT(freeAtStart, (int)ids.size());
+  TEST_ASSERT_TRUE(std::adjacent_find(ids.begin(), ids.end()) == ids.end());  // No id twice
+  TEST_ASSERT_EQUAL_INT(0, reminderSlotsFree());
+  TEST_ASSERT_FALSE(reserveReminderSlot());
+
+  for (int i = 0; i < freeAtStart; i++) {
+    releaseReminderSlot();
+  }
+  TEST_ASSERT_EQUAL_INT(freeAtStart, reminderSlotsFree());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_pushes_arrive_in_order_and_blob_is_released);
+  RUN_TEST(test_reminder_slots_are_claimed_once);
+  return UNITY_END();
+}
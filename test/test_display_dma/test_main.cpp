@@ -0,0 +1,172 @@
+/**
+ * Sprite pushes through the two DMA stripe buffers, against the native DMA
+ * model (one transfer in flight, as on the ESP32): a stripe buffer is never
+ * refilled while its transfer is still queued, nothing touches the TFT
+ * before dmaFence(), and transfers land in the order they were pushed.
+ *
+ *   pio test -e native -f test_display_dma
+ */
+
+#include <unity.h>
+#include "NativeHost.h"
+#include "config.h"
+#include "display_dma.h"
+#include "screen.h"
+
+static const int STRIPES_PER_SCREEN = (TFT_HEIGHT + DMA_STRIPE_LINES - 1) / DMA_STRIPE_LINES;
+
+// A different colour on every row, changing with pass
+static uint16_t rowColor(int y, int pass) {
+  return (uint16_t)((y * 0x0841 + pass * 0x1863) ^ 0xA5A5);
+}
+
+static void paintRows(TFT_eSprite& sprite, int pass) {
+  for (int y = 0; y < sprite.height(); y++) {
+    uint16_t color = sprite.getColorDepth() == 4 ? (uint16_t)((y + pass) & 0x0F) : rowColor(y, pass);
+    sprite.drawFastHLine(0, y, sprite.width(), color);
+  }
+}
+
+// Framebuffer at (x, y) holds the sprite as readPixel() sees it
+static void assertOnScreen(TFT_eSprite& sprite, int x, int y) {
+  const uint16_t* fb = nativeFramebuffer();
+  for (int sy = 0; sy < sprite.height(); sy++) {
+    for (int sx = 0; sx < sprite.width(); sx++) {
+      uint16_t want = sprite.readPixel(sx, sy);
+      uint16_t got = fb[(y + sy) * TFT_WIDTH + x + sx];
+      if (want != got) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "pixel (%d, %d)", x + sx, y + sy);
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE(want, got, msg);
+      }
+    }
+  }
+}
+
+static void assertNoViolations() {
+  TEST_ASSERT_EQUAL_UINT32(0, nativeDmaStats().reuseViolations);
+  TEST_ASSERT_EQUAL_UINT32(0, nativeDmaStats().accessViolations);
+}
+
+void setUp() {
+  dmaFence();
+  tft.resetViewport();
+  tft.fillScreen(TFT_BLACK);
+  nativeResetDmaStats();
+}
+
+void tearDown() {
+  dmaFence();
+}
+
+// The model must notice both kinds of misuse, or the zero counts below mean nothing
+void test_model_catches_misuse() {
+  static uint16_t buffer[TFT_WIDTH * DMA_STRIPE_LINES];
+  tft.startWrite();
+  tft.pushImageDMA(0, 0, TFT_WIDTH, DMA_STRIPE_LINES, buffer);
+  buffer[5] = 0x1234;  // Rewritten before dmaWait()
+  tft.dmaWait();
+  TEST_ASSERT_EQUAL_UINT32(1, nativeDmaStats().reuseViolations);
+
+  tft.pushImageDMA(0, 0, TFT_WIDTH, DMA_STRIPE_LINES, buffer);
+  tft.fillRect(0, 100, 10, 10, TFT_RED);  // Drawn while a transfer is queued
+  TEST_ASSERT_EQUAL_UINT32(1, nativeDmaStats().accessViolations);
+  tft.endWrite();
+}
+
+void test_stripes_complete_before_reuse() {
+  TFT_eSprite sprite(&tft);
+  sprite.setColorDepth(16);
+  TEST_ASSERT_NOT_NULL(sprite.createSprite(TFT_WIDTH, TFT_HEIGHT));
+
+  for (int pass = 0; pass < 8; pass++) {
+    paintRows(sprite, pass);
+    dmaPushSprite(sprite, 0, 0);
+
+    // Every stripe but the last has landed; the last is still in flight
+    TEST_ASSERT_EQUAL_UINT32((pass + 1) * STRIPES_PER_SCREEN, nativeDmaStats().queued);
+    TEST_ASSERT_EQUAL_UINT32((pass + 1) * STRIPES_PER_SCREEN - 1, nativeDmaStats().completed);
+    TEST_ASSERT_TRUE(tft.dmaBusy());
+    // Each stripe buffer was refilled many times, never under a queued transfer
+    TEST_ASSERT_EQUAL_UINT32(0, nativeDmaStats().reuseViolations);
+  }
+
+  dmaFence();
+  TEST_ASSERT_FALSE(tft.dmaBusy());
+  TEST_ASSERT_EQUAL_UINT32(nativeDmaStats().queued, nativeDmaStats().completed);
+  TEST_ASSERT_EQUAL_UINT32(8 * TFT_WIDTH * TFT_HEIGHT, nativeDmaStats().pixels);
+  assertNoViolations();
+  assertOnScreen(sprite, 0, 0);
+}
+
+void test_every_depth_lands_intact() {
+  static const int8_t DEPTHS[] = {16, 8, 4};
+  for (int8_t depth : DEPTHS) {
+    TFT_eSprite sprite(&tft);
+    sprite.setColorDepth(depth);
+    TEST_ASSERT_NOT_NULL(sprite.createSprite(TFT_WIDTH, 65));  // Not a whole number of stripes
+    paintRows(sprite, depth);
+
+    // Redrawing the sprite straight after the push is allowed: it was copied out
+    dmaPushSprite(sprite, 0, 40);
+    sprite.fillSprite(depth == 4 ? 0 : TFT_BLACK);
+    paintRows(sprite, depth);
+    dmaFence();
+
+    assertNoViolations();
+    assertOnScreen(sprite, 0, 40);
+  }
+}
+
+void test_pushes_land_in_order() {
+  TFT_eSprite sprite(&tft);
+  sprite.setColorDepth(16);
+  TEST_ASSERT_NOT_NULL(sprite.createSprite(200, 120));
+
+  // Overlapping pushes with no fence between them: the later one must win
+  paintRows(sprite, 1);
+  dmaPushSprite(sprite, 0, 0);
+  paintRows(sprite, 2);
+  dmaPushSprite(sprite, 60, 50);
+  paintRows(sprite, 3);
+  dmaPushSprite(sprite, 30, 100);
+  dmaFence();
+
+  assertNoViolations();
+  assertOnScreen(sprite, 30, 100);
+
+  // The middle push shows above the last one's rows only
+  const uint16_t* fb = nativeFramebuffer();
+  for (int y = 50; y < 100; y++) {
+    TEST_ASSERT_EQUAL_HEX16(rowColor(y - 50, 2), fb[y * TFT_WIDTH + 250]);
+  }
+  TEST_ASSERT_EQUAL_HEX16(rowColor(20, 1), fb[20 * TFT_WIDTH + 10]);
+}
+
+void test_fence_allows_direct_drawing() {
+  TFT_eSprite sprite(&tft);
+  sprite.setColorDepth(16);
+  TEST_ASSERT_NOT_NULL(sprite.createSprite(TFT_WIDTH, 40));
+  paintRows(sprite, 5);
+
+  for (int i = 0; i < 20; i++) {
+    dmaPushSprite(sprite, 0, (i % 5) * 40);
+    dmaFence();
+    tft.fillRect(0, 220, 50, 20, TFT_GREEN);
+  }
+  assertNoViolations();
+  TEST_ASSERT_EQUAL_UINT32(nativeDmaStats().queued, nativeDmaStats().completed);
+}
+
+int main(int, char**) {
+  tft.init();
+  initDisplayDma();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_model_catches_misuse);
+  RUN_TEST(test_stripes_complete_before_reuse);
+  RUN_TEST(test_every_depth_lands_intact);
+  RUN_TEST(test_pushes_land_in_order);
+  RUN_TEST(test_fence_allows_direct_drawing);
+  return UNITY_END();
+}
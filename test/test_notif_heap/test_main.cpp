@@ -0,0 +1,86 @@
+/**
+ * Notification storage does not touch the heap: after the ring and the
+ * history log have wrapped once, further arrivals leave free heap, the
+ * largest free block and the allocation count exactly where they were.
+ *
+ *   pio test -e native -f test_notif_heap
+ */
+
+#include <unity.h>
+#include "NativeHost.h"
+#include "config.h"
+#include "notif_history.h"
+#include "notif_screen.h"
+
+static const int WARMUP_ADDS = 4000;    // Wraps the list and the history log
+static const int MEASURED_ADDS = 100000;
+
+static const char* APPS[] = {"Slack", "Discord", "WhatsApp", "Teams", "SomeUnknownApp"};
+static const int APP_COUNT = sizeof(APPS) / sizeof(APPS[0]);
+
+// Arrival i: a spread of apps, senders and message lengths (some past the
+// stored limit), close enough together that some merge into an entry
+static void addArrival(int i) {
+  char from[40];
+  char msg[300];
+  snprintf(from, sizeof(from), "sender %d", i % 9);
+  int len = snprintf(msg, sizeof(msg), "%d: ", i);
+  int fill = (i * 37) % 260;
+  while (len < (int)sizeof(msg) - 1 && fill-- > 0) {
+    msg[len] = 'a' + (i + len) % 26;
+    len++;
+  }
+  msg[len] = '\0';
+
+  addNotification(APPS[i % APP_COUNT], from, msg, TFT_WHITE);
+  nativeAdvanceMillis((i % 3) * 400);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_adds_do_not_allocate() {
+  for (int i = 0; i < WARMUP_ADDS; i++) {
+    addArrival(i);
+  }
+  TEST_ASSERT_TRUE(notifHistoryCount() > 0);
+
+  uint32_t freeBefore = ESP.getFreeHeap();
+  uint32_t largestBefore = ESP.getMaxAllocHeap();
+  uint32_t allocsBefore = nativeAllocCount();
+
+  for (int i = WARMUP_ADDS; i < WARMUP_ADDS + MEASURED_ADDS; i++) {
+    addArrival(i);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(allocsBefore, nativeAllocCount());
+  TEST_ASSERT_EQUAL_UINT32(freeBefore, ESP.getFreeHeap());
+  TEST_ASSERT_EQUAL_UINT32(largestBefore, ESP.getMaxAllocHeap());
+
+  // And the arrivals really were stored
+  char prefix[16];
+  snprintf(prefix, sizeof(prefix), "%d: ", WARMUP_ADDS + MEASURED_ADDS - 1);
+  TEST_ASSERT_EQUAL_INT(0, strncmp(notificationAt(0).message, prefix, strlen(prefix)));
+  TEST_ASSERT_EQUAL_INT(0, strncmp(historyMessage(notifHistoryAt(0)), prefix, strlen(prefix)));
+}
+
+void test_clear_does_not_allocate() {
+  uint32_t freeBefore = ESP.getFreeHeap();
+  uint32_t allocsBefore = nativeAllocCount();
+
+  for (int i = 0; i < 1000; i++) {
+    addArrival(i);
+    if (i % 10 == 9) clearAllNotifications();
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(allocsBefore, nativeAllocCount());
+  TEST_ASSERT_EQUAL_UINT32(freeBefore, ESP.getFreeHeap());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_adds_do_not_allocate);
+  RUN_TEST(test_clear_does_not_allocate);
+  return UNITY_END();
+}
@@ -0,0 +1,275 @@
+/**
+ * Text layout against TFT_eSPI: textWidthPx() and every wrapped line agree
+ * with tft.textWidth() for the bundled fonts, and layoutWrap() breaks lines
+ * exactly where a textWidth() loop would, faster and without allocating.
+ *
+ *   pio test -e native -f test_text_layout
+ */
+
+#include <unity.h>
+#include <chrono>
+#include "NativeHost.h"
+#include "config.h"
+#include "screen.h"
+#include "text_layout.h"
+#include "fonts/MDIOTrial_Bold10pt7b.h"
+#include "fonts/MDIOTrial_Bold8pt7b.h"
+#include "fonts/MDIOTrial_Bold9pt7b.h"
+#include "fonts/MDIOTrial_Regular10pt7b.h"
+#include "fonts/MDIOTrial_Regular8pt7b.h"
+#include "fonts/MDIOTrial_Regular9pt7b.h"
+
+// In FontId order
+static const GFXfont* FONTS[FONT_COUNT] = {
+  &MDIOTrial_Bold10pt7b, &MDIOTrial_Bold8pt7b, &MDIOTrial_Bold9pt7b,
+  &MDIOTrial_Regular10pt7b, &MDIOTrial_Regular8pt7b, &MDIOTrial_Regular9pt7b,
+};
+
+static const int SAMPLE_MESSAGES = 2000;
+static const int BENCH_ROUNDS = 20;     // Passes over the samples per timing
+static const int MAX_LINES = 4;
+
+static char samples[SAMPLE_MESSAGES][NOTIF_MSG_MAX_CHARS + 1];
+
+// Deterministic so a failure reproduces
+static uint32_t rngState;
+static uint32_t nextRandom() {
+  rngState = rngState * 1664525u + 1013904223u;
+  return rngState >> 8;
+}
+
+// Words of 1-14 printable characters, the odd 30-character word and newline
+static void makeMessage(char* out, int size) {
+  int len = 4 + nextRandom() % (size - 4);
+  int pos = 0;
+  while (pos < len) {
+    int word = nextRandom() % 16 == 0 ? 30 : 1 + nextRandom() % 14;
+    for (int i = 0; i < word && pos < len; i++) {
+      out[pos++] = 33 + nextRandom() % 94;
+    }
+    if (pos < len) out[pos++] = nextRandom() % 24 == 0 ? '\n' : ' ';
+  }
+  out[pos] = '\0';
+}
+
+// ==================== textWidth() Reference ====================
+// Width of text[start, end) (plus "..." if asked) the way drawing code
+// measured before text_layout: copy it out and call tft.textWidth()
+static int measured(const char* text, int start, int end, bool ellipsis) {
+  char buf[NOTIF_MSG_MAX_CHARS + 4];
+  int n = end - start;
+  memcpy(buf, text + start, n);
+  if (ellipsis) {
+    memcpy(buf + n, "...", 3);
+    n += 3;
+  }
+  buf[n] = '\0';
+  return tft.textWidth(buf);
+}
+
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t';
+}
+
+static void referenceLine(const char* text, int start, int end, bool ellipsis, TextLine* line) {
+  while (start < end && isSpace(text[start])) start++;
+  while (end > start && isSpace(text[end - 1])) end--;
+  line->start = start;
+  line->len = end - start;
+  line->ellipsis = ellipsis;
+  line->width = measured(text, start, end, ellipsis);
+}
+
+// layoutWrap()'s rules, measuring every candidate with tft.textWidth()
+static int referenceWrap(const char* text, int maxWidth, TextLine* lines, int maxLines) {
+  int textLen = strlen(text);
+  int pos = 0;
+  int count = 0;
+
+  while (count < maxLines) {
+    while (pos < textLen && isSpace(text[pos])) pos++;
+    if (pos >= textLen) {
+      break;
+    }
+
+    int end = pos;
+    int lastSpace = -1;
+    bool newline = false;
+    while (end < textLen) {
+      if (text[end] == '\n') {
+        newline = true;
+        break;
+      }
+      if (measured(text, pos, end + 1, false) > maxWidth) {
+        break;
+      }
+      if (isSpace(text[end])) lastSpace = end;
+      end++;
+    }
+
+    if (!newline && end >= textLen) {
+      referenceLine(text, pos, end, false, &lines[count++]);
+      break;
+    }
+
+    if (count == maxLines - 1) {
+      int cut = end;
+      while (cut > pos && measured(text, pos, cut, true) > maxWidth) {
+        cut--;
+      }
+      if (!newline || cut < end) {
+        for (int i = cut; i > pos; i--) {
+          if (isSpace(text[i])) {
+            cut = i;
+            break;
+          }
+        }
+      }
+      referenceLine(text, pos, cut, true, &lines[count++]);
+      break;
+    }
+
+    if (newline) {
+      referenceLine(text, pos, end, false, &lines[count++]);
+      pos = end + 1;
+    } else if (lastSpace > pos) {
+      referenceLine(text, pos, lastSpace, false, &lines[count++]);
+      pos = lastSpace + 1;
+    } else {
+      if (end == pos) end++;
+      referenceLine(text, pos, end, false, &lines[count++]);
+      pos = end;
+    }
+  }
+  return count;
+}
+
+// ==================== Tests ====================
+void setUp() {
+  rngState = 12345;
+  for (int i = 0; i < SAMPLE_MESSAGES; i++) {
+    makeMessage(samples[i], sizeof(samples[i]));
+  }
+}
+
+void tearDown() {
+  tft.setFreeFont(nullptr);
+}
+
+void test_widths_match_textWidth() {
+  for (int f = 0; f < FONT_COUNT; f++) {
+    tft.setFreeFont(FONTS[f]);
+
+    // Every glyph alone and after every other (last-glyph rule)
+    char pair[3] = {0};
+    for (int a = 32; a < 127; a++) {
+      pair[0] = (char)a;
+      pair[1] = '\0';
+      TEST_ASSERT_EQUAL_INT(tft.textWidth(pair), textWidthPx((FontId)f, pair));
+      for (int b = 32; b < 127; b++) {
+        pair[1] = (char)b;
+        TEST_ASSERT_EQUAL_INT(tft.textWidth(pair), textWidthPx((FontId)f, pair));
+      }
+    }
+
+    for (int i = 0; i < SAMPLE_MESSAGES; i++) {
+      TEST_ASSERT_EQUAL_INT(tft.textWidth(samples[i]), textWidthPx((FontId)f, samples[i]));
+    }
+  }
+}
+
+// Straight from the font's glyph table: advances, then the last glyph's ink
+static int glyphTableWidth(const GFXfont* font, const char* text) {
+  int width = 0;
+  for (const char* p = text; *p != '\0'; p++) {
+    const GFXglyph& g = font->glyph[(uint8_t)*p - font->first];
+    width += p[1] != '\0' ? g.xAdvance : g.xOffset + g.width;
+  }
+  return width;
+}
+
+// Not circular: the expected widths come from src/fonts/*.h, not from the stub
+void test_widths_match_glyph_tables() {
+  static const char* TEXTS[] = {"Meeting at 5", "Meeting at five", "Room 101", "7"};
+  for (int f = 0; f < FONT_COUNT; f++) {
+    tft.setFreeFont(FONTS[f]);
+    for (const char* text : TEXTS) {
+      int want = glyphTableWidth(FONTS[f], text);
+      TEST_ASSERT_EQUAL_INT(want, textWidthPx((FontId)f, text));
+      TEST_ASSERT_EQUAL_INT(want, tft.textWidth(text));
+    }
+  }
+
+  // A trailing digit is measured by its ink, not its advance, unless drawn as a number
+  const GFXglyph& five = MDIOTrial_Regular8pt7b.glyph['5' - MDIOTrial_Regular8pt7b.first];
+  TEST_ASSERT_TRUE(five.xOffset + five.width != five.xAdvance);
+  TEST_ASSERT_EQUAL_INT(textAdvancePx(FONT_REGULAR_8, "Meeting at ", 11) + five.xOffset + five.width,
+                        textWidthPx(FONT_REGULAR_8, "Meeting at 5"));
+}
+
+void test_wrap_matches_textWidth_loop() {
+  static const int WIDTHS[] = {60, 140, NOTIF_SENDER_MAX_W, CONTENT_TEXT_MAX_W};
+  for (int f = 0; f < FONT_COUNT; f++) {
+    tft.setFreeFont(FONTS[f]);
+    for (int w : WIDTHS) {
+      for (int i = 0; i < SAMPLE_MESSAGES; i++) {
+        TextLine got[MAX_LINES], want[MAX_LINES];
+        int n = layoutWrap((FontId)f, samples[i], w, got, MAX_LINES);
+        TEST_ASSERT_EQUAL_INT(referenceWrap(samples[i], w, want, MAX_LINES), n);
+        for (int l = 0; l < n; l++) {
+          TEST_ASSERT_EQUAL_INT(want[l].start, got[l].start);
+          TEST_ASSERT_EQUAL_INT(want[l].len, got[l].len);
+          TEST_ASSERT_EQUAL(want[l].ellipsis, got[l].ellipsis);
+          TEST_ASSERT_EQUAL_INT(want[l].width, got[l].width);
+
+          // As drawn: the copied line measures the same and fits
+          char buf[NOTIF_MSG_MAX_CHARS + 4];
+          layoutCopyLine(samples[i], got[l], buf, sizeof(buf));
+          TEST_ASSERT_EQUAL_INT(tft.textWidth(buf), got[l].width);
+          TEST_ASSERT_TRUE(got[l].width <= w || got[l].len == 1);
+        }
+      }
+    }
+  }
+}
+
+void test_wrap_benchmark() {
+  typedef std::chrono::steady_clock Clock;
+  TextLine lines[CONTENT_TEXT_LINES];
+  volatile int sink = 0;
+  tft.setFreeFont(FONTS[FONT_REGULAR_8]);
+
+  uint32_t allocsBefore = nativeAllocCount();
+  Clock::time_point start = Clock::now();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < SAMPLE_MESSAGES; i++) {
+      sink += layoutWrap(FONT_REGULAR_8, samples[i], CONTENT_TEXT_MAX_W, lines, CONTENT_TEXT_LINES);
+    }
+  }
+  double layoutNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  TEST_ASSERT_EQUAL_UINT32(allocsBefore, nativeAllocCount());
+
+  start = Clock::now();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < SAMPLE_MESSAGES; i++) {
+      sink += referenceWrap(samples[i], CONTENT_TEXT_MAX_W, lines, CONTENT_TEXT_LINES);
+    }
+  }
+  double loopNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+  int messages = BENCH_ROUNDS * SAMPLE_MESSAGES;
+  char report[120];
+  snprintf(report, sizeof(report), "layoutWrap %.0f ns/message, textWidth loop %.0f ns/message (%.1fx)",
+           layoutNs / messages, loopNs / messages, loopNs / layoutNs);
+  TEST_MESSAGE(report);
+  (void)sink;
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_widths_match_textWidth);
+  RUN_TEST(test_widths_match_glyph_tables);
+  RUN_TEST(test_wrap_matches_textWidth_loop);
+  RUN_TEST(test_wrap_benchmark);
+  return UNITY_END();
+}
@@ -5,8 +5,13 @@ Font Generator for MDIO Trial Fonts with Extended Character Range
 This script uses the fonttools library to generate Adafruit GFX-compatible font headers
 from TTF files, supporting extended ASCII characters (0x20-0xFF).
 
+It also writes src/fonts/font_metrics.h/.cpp: per-glyph advance and inked
+width tables for every font header, used by the text layout module
+(src/text_layout.h) to measure and wrap text without touching the glyphs.
+
 Usage:
     python generate_fonts.py <path_to_ttf_regular> <path_to_ttf_bold>
+    python generate_fonts.py --metrics     (regenerate the tables only)
 
 Example:
     python generate_fonts.py "C:/Fonts/MDIOTrial-Regular.ttf" "C:/Fonts/MDIOTrial-Bold.ttf"
@@ -14,6 +19,7 @@ Example:
 
 import sys
 import os
+import re
 import subprocess
 import tempfile
 import shutil
@@ -110,7 +116,113 @@ def generate_font(fontconvert_path, ttf_path, font_name, size, output_path):
         return False
 
 
+# ==================== Glyph Metrics Tables ====================
+FONT_HEADER_RE = re.compile(r"^(\w+?)_([A-Za-z]+)(\d+)pt7b\.h$")
+GLYPH_RE = re.compile(r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}")
+FONT_RE = re.compile(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{[^}]*?"
+                     r"(0x[0-9A-Fa-f]+|\d+),\s*(0x[0-9A-Fa-f]+|\d+),\s*(\d+)\s*\}", re.S)
+
+
+def parse_gfx_font(path):
+    """Read glyph advances/extents and the first/last/yAdvance fields of a GFX font header."""
+    content = path.read_text(encoding="utf-8")
+    font = FONT_RE.search(content)
+    glyph_start = content.find("Glyphs[] PROGMEM")
+    if not font or glyph_start < 0:
+        return None
+
+    glyphs = GLYPH_RE.findall(content[glyph_start:font.start()])
+    first, last = int(font.group(2), 0), int(font.group(3), 0)
+    if len(glyphs) != last - first + 1:
+        return None
+
+    return {
+        "name": font.group(1),
+        "first": first,
+        "last": last,
+        "y_advance": int(font.group(4)),
+        # xAdvance, and xOffset + width (the inked right edge, used for the last glyph)
+        "advance": [int(g[3]) for g in glyphs],
+        "ink": [int(g[4]) + int(g[1]) for g in glyphs],
+    }
+
+
+def format_table(values):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append("  " + ", ".join(f"{v:3d}" for v in values[i:i+16]))
+    return ",\n".join(lines)
+
+
+def write_font_metrics(font_dir):
+    """Generate font_metrics.h/.cpp from every *pt7b.h header in font_dir."""
+    fonts = []
+    for path in sorted(font_dir.glob("*pt7b.h")):
+        match = FONT_HEADER_RE.match(path.name)
+        font = parse_gfx_font(path)
+        if not match or not font:
+            print(f"  ✗ Skipped (not a GFX font header): {path.name}")
+            continue
+        font["id"] = f"FONT_{match.group(2).upper()}_{match.group(3)}"
+        fonts.append(font)
+
+    header = [
+        "// Auto-generated by tools/generate_fonts.py from src/fonts/*pt7b.h - do not edit",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "// Fonts with glyph metrics tables (same order as FONT_METRICS)",
+        "enum FontId {",
+    ]
+    header += [f"  {f['id']},  // {f['name']}" for f in fonts]
+    header += [
+        "  FONT_COUNT",
+        "};",
+        "",
+        "struct FontMetrics {",
+        "  uint8_t first;           // First character in the tables",
+        "  uint8_t last;            // Last character in the tables",
+        "  uint8_t yAdvance;        // Line height",
+        "  const uint8_t* advance;  // xAdvance per glyph",
+        "  const int8_t* ink;       // xOffset + width per glyph (right edge of the ink)",
+        "};",
+        "",
+        "extern const FontMetrics FONT_METRICS[FONT_COUNT];",
+        "",
+    ]
+
+    source = [
+        "// Auto-generated by tools/generate_fonts.py from src/fonts/*pt7b.h - do not edit",
+        '#include "font_metrics.h"',
+        "",
+    ]
+    for f in fonts:
+        count = f["last"] - f["first"] + 1
+        source += [
+            f"static const uint8_t {f['name']}Advance[{count}] PROGMEM = {{",
+            format_table(f["advance"]),
+            "};",
+            "",
+            f"static const int8_t {f['name']}Ink[{count}] PROGMEM = {{",
+            format_table(f["ink"]),
+            "};",
+            "",
+        ]
+    source.append("const FontMetrics FONT_METRICS[FONT_COUNT] = {")
+    source += [f"  {{0x{f['first']:02X}, 0x{f['last']:02X}, {f['y_advance']}, "
+               f"{f['name']}Advance, {f['name']}Ink}},  // {f['id']}" for f in fonts]
+    source += ["};", ""]
+
+    (font_dir / "font_metrics.h").write_text("\n".join(header), encoding="utf-8")
+    (font_dir / "font_metrics.cpp").write_text("\n".join(source), encoding="utf-8")
+    print(f"  ✓ Generated: font_metrics.h/.cpp ({len(fonts)} fonts)")
+
+
 def main():
+    if len(sys.argv) == 2 and sys.argv[1] == "--metrics":
+        write_font_metrics(OUTPUT_DIR)
+        return
+
     print("\n" + "="*70)
     print("MDIO Trial Font Generator - Extended Character Range (0x20-0xFF)")
     print("="*70)
@@ -179,6 +291,9 @@ This will generate font headers with extended characters including:
 
     print(f"\nCompleted: {success_count}/{total_count} fonts generated")
 
+    # Width tables for the layout engine
+    write_font_metrics(OUTPUT_DIR)
+
     if success_count == total_count:
         print("\n✓ All fonts generated successfully!")
         print("\nNew characters available:")
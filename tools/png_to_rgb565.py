@@ -1,7 +1,11 @@
 #!/usr/bin/env python3
 """
 Convert PNG images to RGB565 C header arrays for TFT_eSPI sprites.
-Outputs PROGMEM-compatible arrays for ESP32.
+Outputs PROGMEM-compatible arrays for ESP32, either raw or (--rle) as a
+palette + run-length RleSprite (see src/rle_sprite.h).
+
+--atlas builds src/icons/icon_atlas.h from src/icons/app_icons.txt: every
+app icon in one byte-swapped array plus a perfect-hash app name table.
 """
 
 import os
@@ -14,8 +18,111 @@ def rgb_to_565(r, g, b):
     # No byte swap needed - pushImage handles endianness
     return rgb565
 
-def convert_png_to_header(input_path, output_path, array_name, enhance=True):
-    """Convert a PNG file to a C header with RGB565 array."""
+# ==================== Palette + RLE ====================
+RLE_MAX_COLORS = 16      # Palette index lives in the high nibble of a run byte
+RLE_SHORT_MAX = 15       # Runs of 1..15 px fit in one byte
+RLE_LONG_MAX = 16 + 255  # Low nibble 15: length is 16 + next byte
+
+
+def encode_rle_row(row, palette_index):
+    """Encode one row of RGB565 values as run bytes."""
+    out = bytearray()
+    i = 0
+    while i < len(row):
+        color = row[i]
+        run = 1
+        while i + run < len(row) and row[i + run] == color and run < RLE_LONG_MAX:
+            run += 1
+        idx = palette_index[color]
+        if run <= RLE_SHORT_MAX:
+            out.append((idx << 4) | (run - 1))
+        else:
+            out.append((idx << 4) | 0x0F)
+            out.append(run - 16)
+        i += run
+    return bytes(out)
+
+
+def encode_rle(pixels, width, height):
+    """
+    Encode RGB565 pixels as (palette, row_offsets, data).
+    Identical rows are stored once and share an offset.
+    Returns None if the image has more than RLE_MAX_COLORS colours.
+    """
+    palette = sorted(set(pixels))
+    if len(palette) > RLE_MAX_COLORS:
+        return None
+    palette_index = {c: i for i, c in enumerate(palette)}
+
+    data = bytearray()
+    row_offsets = []
+    seen = {}
+    for y in range(height):
+        encoded = encode_rle_row(pixels[y * width:(y + 1) * width], palette_index)
+        if encoded not in seen:
+            seen[encoded] = len(data)
+            data += encoded
+        row_offsets.append(seen[encoded])
+    return palette, row_offsets, bytes(data)
+
+
+def format_values(values, fmt):
+    """Format values 16 per line for a C initialiser."""
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append("    " + ", ".join(fmt.format(v) for v in values[i:i+16]))
+    return ",\n".join(lines)
+
+
+def write_rle_header(output_path, array_name, source_name, width, height, rgb565_data):
+    """
+    Write an RleSprite header for already-converted RGB565 pixels.
+    Returns the encoded size in bytes, or None if the image has too many colours.
+    """
+    encoded = encode_rle(rgb565_data, width, height)
+    if encoded is None:
+        return None
+    palette, row_offsets, data = encoded
+    if len(data) > 0xFFFF:
+        return None
+    encoded_bytes = len(palette) * 2 + len(row_offsets) * 2 + len(data)
+
+    header = f"""// Auto-generated from {source_name}
+// Dimensions: {width}x{height}, {len(palette)} colours, palette + RLE ({encoded_bytes:,} bytes, raw {width * height * 2:,})
+#pragma once
+#include <Arduino.h>
+#include "../rle_sprite.h"
+
+const uint16_t {array_name}_WIDTH = {width};
+const uint16_t {array_name}_HEIGHT = {height};
+
+const uint16_t {array_name}_PALETTE[{len(palette)}] PROGMEM = {{
+{format_values(palette, "0x{:04X}")}
+}};
+
+const uint16_t {array_name}_ROWS[{height}] PROGMEM = {{
+{format_values(row_offsets, "{}")}
+}};
+
+const uint8_t {array_name}_RLE[{len(data)}] PROGMEM = {{
+{format_values(list(data), "0x{:02X}")}
+}};
+
+const RleSprite {array_name} = {{
+    {array_name}_WIDTH, {array_name}_HEIGHT,
+    {array_name}_PALETTE, {array_name}_ROWS, {array_name}_RLE
+}};
+"""
+
+    with open(output_path, 'w') as f:
+        f.write(header)
+
+    return encoded_bytes
+
+
+# ==================== Raw Arrays ====================
+def load_rgb565(input_path, enhance=True):
+    """Read a PNG as (width, height, RGB565 pixels)."""
     img = Image.open(input_path).convert('RGB')
 
     # Enhance for small SPI display (boost colors and contrast)
@@ -31,7 +138,23 @@ def convert_png_to_header(input_path, output_path, array_name, enhance=True):
     pixels = list(img.getdata())
 
     # Convert to RGB565
-    rgb565_data = [rgb_to_565(r, g, b) for r, g, b in pixels]
+    return width, height, [rgb_to_565(r, g, b) for r, g, b in pixels]
+
+
+def convert_png_to_header(input_path, output_path, array_name, enhance=True, rle=False):
+    """Convert a PNG file to a C header with RGB565 array."""
+    width, height, rgb565_data = load_rgb565(input_path, enhance)
+
+    if rle:
+        encoded_bytes = write_rle_header(output_path, array_name, os.path.basename(input_path),
+                                         width, height, rgb565_data)
+        if encoded_bytes is None:
+            print(f"[ERROR] {os.path.basename(input_path)} has more than {RLE_MAX_COLORS} colours, "
+                  "convert without --rle")
+            return
+        print(f"[OK] {os.path.basename(input_path)} -> {os.path.basename(output_path)} "
+              f"({width}x{height}, {encoded_bytes} bytes RLE, raw {len(rgb565_data)*2})")
+        return
 
     # Generate header content
     header = f"""// Auto-generated from {os.path.basename(input_path)}
@@ -60,7 +183,126 @@ const uint16_t {array_name}[{width * height}] PROGMEM = {{
 
     print(f"[OK] {os.path.basename(input_path)} -> {os.path.basename(output_path)} ({width}x{height}, {len(rgb565_data)*2} bytes)")
 
+# ==================== Icon Atlas ====================
+ICON_SIZE = 14          # ICON_WIDTH x ICON_HEIGHT in config.h
+FNV_PRIME = 16777619
+NO_BITMAP = 0xFF        # APP_NO_BITMAP in icons.h
+
+
+def app_hash(name, seed):
+    """32-bit FNV-1a from seed, high half folded into the low bits (matches appHash() in icons.cpp)."""
+    h = seed
+    for c in name.encode():
+        h = ((h ^ c) * FNV_PRIME) & 0xFFFFFFFF
+    return h ^ (h >> 16)
+
+
+def find_hash_seed(names, table_size):
+    """First seed that gives every name its own slot in a table_size table."""
+    for seed in range(0x811C9DC5, 0x811C9DC5 + 1000000):
+        if len({app_hash(n, seed) & (table_size - 1) for n in names}) == len(names):
+            return seed
+    return None
+
+
+def read_icon_manifest(manifest_path):
+    """Parse 'name icon' lines; returns [(name, icon)] in file order."""
+    entries = []
+    with open(manifest_path) as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            name, icon = line.split()
+            entries.append((name.lower(), icon))
+    return entries
+
+
+def write_icon_atlas(manifest_path, output_path):
+    """
+    Write every PNG named in the manifest into one PROGMEM array (ICON_SIZE
+    squared pixels each, byte-swapped for the panel) and the app names into
+    a power-of-two table indexed by app_hash(name, APP_HASH_SEED).
+    """
+    icon_dir = os.path.dirname(manifest_path)
+    entries = read_icon_manifest(manifest_path)
+
+    bitmaps = []           # PNG file names, atlas order
+    atlas = []
+    for _, icon in entries:
+        if icon.startswith("badge:") or icon in bitmaps:
+            continue
+        width, height, pixels = load_rgb565(os.path.join(icon_dir, icon))
+        if (width, height) != (ICON_SIZE, ICON_SIZE):
+            print(f"[ERROR] {icon} is {width}x{height}, icons must be {ICON_SIZE}x{ICON_SIZE}")
+            return False
+        bitmaps.append(icon)
+        atlas += [((v >> 8) | (v << 8)) & 0xFFFF for v in pixels]
+    if not bitmaps:
+        print("[ERROR] manifest names no PNG icons")
+        return False
+
+    names = [name for name, _ in entries]
+    if len(set(names)) != len(names):
+        print("[ERROR] duplicate app names in manifest")
+        return False
+    table_size = 1
+    while table_size < len(names):
+        table_size *= 2
+    seed = find_hash_seed(names, table_size)
+    if seed is None:
+        table_size *= 2
+        seed = find_hash_seed(names, table_size)
+
+    table = ["  {nullptr, APP_NO_BITMAP, 0}"] * table_size
+    for name, icon in entries:
+        slot = app_hash(name, seed) & (table_size - 1)
+        if icon.startswith("badge:"):
+            table[slot] = f'  {{"{name}", APP_NO_BITMAP, {icon[len("badge:"):]}}}'
+        else:
+            table[slot] = f'  {{"{name}", {bitmaps.index(icon)}, 0}}'
+
+    table_rows = ",\n".join(table)
+    header = f"""// Auto-generated from {os.path.basename(manifest_path)} by tools/png_to_rgb565.py --atlas
+// {len(bitmaps)} bitmaps ({len(atlas) * 2:,} bytes), {len(names)} app names in {table_size} slots
+#pragma once
+#include <Arduino.h>
+#include "../config.h"
+
+// {ICON_SIZE}x{ICON_SIZE} bitmaps back to back, byte-swapped (pushImage order with swap bytes off)
+const uint8_t ICON_ATLAS_COUNT = {len(bitmaps)};
+const uint16_t ICON_ATLAS[{len(atlas)}] PROGMEM = {{
+{format_values(atlas, "0x{:04X}")}
+}};
+
+// Slot = appHash(lower-case name, APP_HASH_SEED) & (APP_TABLE_SIZE - 1); every name has its own slot
+const uint32_t APP_HASH_SEED = 0x{seed:08X};
+const uint8_t APP_TABLE_SIZE = {table_size};
+const AppIconEntry APP_TABLE[APP_TABLE_SIZE] = {{
+{table_rows}
+}};
+"""
+
+    with open(output_path, 'w') as f:
+        f.write(header)
+
+    print(f"[OK] {os.path.basename(manifest_path)} -> {os.path.basename(output_path)} "
+          f"({len(bitmaps)} bitmaps, {len(names)} apps, seed 0x{seed:08X})")
+    return True
+
+
 def main():
+    base_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    os.chdir(base_dir)
+
+    # --atlas: regenerate the app icon atlas and name table
+    if "--atlas" in sys.argv[1:]:
+        write_icon_atlas("src/icons/app_icons.txt", "src/icons/icon_atlas.h")
+        return
+
+    # --rle: emit palette + RLE headers (backgrounds with few colours, no enhancement)
+    rle = "--rle" in sys.argv[1:]
+
     # Define sprite conversions
     sprites = [
         ("src/sprites/fixed_title.png", "src/sprites/sprite_title.h", "SPRITE_TITLE"),
@@ -69,15 +311,12 @@ def main():
         ("src/sprites/fixed_content.png", "src/sprites/sprite_content.h", "SPRITE_CONTENT"),
     ]
 
-    base_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
-    os.chdir(base_dir)
-
     print("Converting sprites to RGB565 headers...")
     print("=" * 50)
 
     for input_path, output_path, array_name in sprites:
         if os.path.exists(input_path):
-            convert_png_to_header(input_path, output_path, array_name)
+            convert_png_to_header(input_path, output_path, array_name, enhance=not rle, rle=rle)
         else:
             print(f"[MISSING] {input_path} not found")
 
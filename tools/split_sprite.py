@@ -2,12 +2,14 @@
 """
 Split a 320x240 sprite into zone-based C header arrays for TFT_eSPI sprites.
 Zones are read dynamically from types.h to stay in sync with the C code.
+Each zone is written as a palette + RLE RleSprite (see src/rle_sprite.h).
 """
 
 import os
 import sys
 import re
 from PIL import Image
+from png_to_rgb565 import write_rle_header, RLE_MAX_COLORS
 
 
 def parse_types_h(types_h_path):
@@ -97,39 +99,21 @@ def crop_zone(img, zone):
     return img.crop((x1, y1, x2, y2))
 
 def save_header(zone_img, output_path, array_name, source_name):
-    """Save a zone image as a C header file."""
+    """Save a zone image as a palette + RLE C header file."""
     width, height = zone_img.size
     pixels = list(zone_img.getdata())
 
     # Convert to RGB565
     rgb565_data = [rgb_to_565(r, g, b) for r, g, b in pixels]
 
-    # Generate header content
-    header = f"""// Auto-generated from {source_name}
-// Dimensions: {width}x{height}
-#pragma once
-#include <Arduino.h>
-
-const uint16_t {array_name}_WIDTH = {width};
-const uint16_t {array_name}_HEIGHT = {height};
-
-const uint16_t {array_name}[{width * height}] PROGMEM = {{
-"""
-
-    # Format data in rows of 16 values
-    lines = []
-    for i in range(0, len(rgb565_data), 16):
-        row = rgb565_data[i:i+16]
-        line = "    " + ", ".join(f"0x{v:04X}" for v in row)
-        lines.append(line)
-
-    header += ",\n".join(lines)
-    header += "\n};\n"
-
-    with open(output_path, 'w') as f:
-        f.write(header)
+    encoded_bytes = write_rle_header(output_path, array_name, source_name,
+                                     width, height, rgb565_data)
+    if encoded_bytes is None:
+        print(f"[ERROR] {array_name} has more than {RLE_MAX_COLORS} colours - "
+              "reduce the background palette")
+        sys.exit(1)
 
-    return width, height, len(rgb565_data) * 2
+    return width, height, encoded_bytes, len(rgb565_data) * 2
 
 def split_sprite(input_path, output_dir, zones):
     """Split a 320x240 sprite into zone header files."""
@@ -146,6 +130,7 @@ def split_sprite(input_path, output_dir, zones):
     print("=" * 50)
 
     total_bytes = 0
+    total_raw = 0
 
     for zone_name, zone in zones.items():
         # Crop zone from full image
@@ -155,13 +140,14 @@ def split_sprite(input_path, output_dir, zones):
         output_path = os.path.join(output_dir, f"sprite_{zone_name}.h")
 
         # Save as header
-        w, h, bytes_size = save_header(zone_img, output_path, zone['array_name'], source_name)
+        w, h, bytes_size, raw_size = save_header(zone_img, output_path, zone['array_name'], source_name)
         total_bytes += bytes_size
+        total_raw += raw_size
 
-        print(f"  [OK] {zone_name.upper():8} -> sprite_{zone_name}.h ({w}x{h}, {bytes_size:,} bytes)")
+        print(f"  [OK] {zone_name.upper():8} -> sprite_{zone_name}.h ({w}x{h}, {bytes_size:,} bytes, raw {raw_size:,})")
 
     print("=" * 50)
-    print(f"Total: {total_bytes:,} bytes ({total_bytes / 1024:.1f} KB)")
+    print(f"Total: {total_bytes:,} bytes ({total_bytes / 1024:.1f} KB), raw {total_raw:,} bytes")
 
 def main():
     base_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))